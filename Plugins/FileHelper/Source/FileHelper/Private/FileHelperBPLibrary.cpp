@@ -2,16 +2,27 @@
 
 #include "FileHelperBPLibrary.h"
 
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "FileHelperBase64.h"
+#include "FileHelperCompression.h"
+#include "FileHelperHash.h"
+#include "FileHelperCsvCache.h"
+#include "FileHelperExportPlan.h"
+#include "FileHelperLineIndex.h"
+#include "FileHelperLineMatcher.h"
+#include "FileHelperLineReader.h"
+#include "FileHelperNative.h"
+#include "FileHelperUtf8.h"
 #include "HAL/PlatformFileManager.h"
 #include "HAL/FileManager.h"
 #include "Misc/FileHelper.h"
-#include "Misc/Base64.h"
 #include "Math/Color.h"
 #include "Misc/ConfigCacheIni.h"
+#include "Serialization/MemoryWriter.h"
 #include "Engine/DataTable.h"
 #include "Internationalization/Regex.h"
 #include "Runtime/Launch/Resources/Version.h"
-#include "Serialization/Csv/CsvParser.h"
 #include "UObject/TextProperty.h"
 
 class FCustomFileVisitor : public IPlatformFile::FDirectoryVisitor
@@ -73,65 +84,41 @@ FProjectPath UFileHelperBPLibrary::GetProjectDirectories()
 	return P;
 }
 
-bool UFileHelperBPLibrary::ReadText(FString Path, FString& Output)
+bool UFileHelperBPLibrary::ReadText(const FString& Path, FString& Output)
 {
-	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
-	if (FileManager.FileExists(*Path))
-	{
-		return FFileHelper::LoadFileToString(Output, *Path);
-	}
-	return false;
+	return FFileHelperNative::ReadText(Path, Output);
 }
 
-bool UFileHelperBPLibrary::SaveText(FString Path, FString Text, FString& Error, bool Append, bool Force)
+bool UFileHelperBPLibrary::SaveText(const FString& Path, const FString& Text, FString& Error, bool Append, bool Force)
 {
-	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
-	FText ErrorFilename;
-	if (!FFileHelper::IsFilenameValidForSaving(Path, ErrorFilename))
-	{
-		Error = FString("Filename is not valid");
-		return false;
-	}
-	if (!FileManager.FileExists(*Path) || Append || Force)
-	{
-		return FFileHelper::SaveStringToFile(Text, *Path, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), Append ? FILEWRITE_Append : FILEWRITE_None);
-	}
-	else
-	{
-		Error = FString("File already exists");
-	}
-	return false;
+	return FFileHelperNative::SaveText(Path, Text, Error, Append, Force);
 }
 
-bool UFileHelperBPLibrary::SaveCSV(FString Path, TArray<FString> Headers, TArray<FString> Data, int32& Total, bool Force)
+bool UFileHelperBPLibrary::SaveCSV(const FString& Path, const TArray<FString>& Headers, const TArray<FString>& Data, int32& Total, bool Force, bool QuoteAll)
 {
-	FString Output;
-	if (!UFileHelperBPLibrary::CSVToString(Output, Headers, Data, Total))
-	{
-		return false;
-	}
-	FString Error;
-	return UFileHelperBPLibrary::SaveText(Path, Output, Error, false, Force);
+	return FFileHelperNative::SaveCSV(Path, Headers, Data, Total, Force, QuoteAll);
 }
 
-bool UFileHelperBPLibrary::ReadCSV(FString Path, TArray<FString>& Headers, TArray<FString>& Data, int32& Total, bool HeaderFirst)
+bool UFileHelperBPLibrary::QueryCSV(const FString& Path, const TArray<FString>& Columns, const TArray<FFileHelperCSVFilter>& Filters, TArray<FString>& Headers, TArray<FString>& Data, int32& Total)
 {
-	Total = 0;
-	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
-	if (!FileManager.FileExists(*Path))
-	{
-		return false;
-	}
-	FString Result;
-	if (!FFileHelper::LoadFileToString(Result, *Path))
+	return FFileHelperNative::QueryCSV(Path, Columns, Filters, Headers, Data, Total);
+}
+
+bool UFileHelperBPLibrary::ReadCSV(const FString& Path, TArray<FString>& Headers, TArray<FString>& Data, int32& Total, bool HeaderFirst, bool Parallel, bool UseCache)
+{
+	if (Parallel && !UseCache)
 	{
-		return false;
+		return FFileHelperNative::ReadCSVParallel(Path, Headers, Data, Total, HeaderFirst);
 	}
-	return UFileHelperBPLibrary::StringToCSV(Result, Headers, Data, Total, HeaderFirst);
-	// return UFileHelperBPLibrary::StringArrayToCSV(Result, Headers, Data, Total, ",", HeaderFirst);
+	return FFileHelperNative::ReadCSV(Path, Headers, Data, Total, HeaderFirst, UseCache);
 }
 
-bool UFileHelperBPLibrary::ReadLine(FString Path, FString Pattern, TArray<FString>& Lines)
+bool UFileHelperBPLibrary::RemoveCSVCache(const FString& Path)
+{
+	return FFileHelperCsvCache::Remove(Path);
+}
+
+bool UFileHelperBPLibrary::ReadLine(FString Path, FString Pattern, TArray<FString>& Lines, EFileHelperPatternMode Mode)
 {
 	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
 	if (!FileManager.FileExists(*Path))
@@ -140,13 +127,30 @@ bool UFileHelperBPLibrary::ReadLine(FString Path, FString Pattern, TArray<FStrin
 	}
 	if (!Pattern.IsEmpty())
 	{
-		FRegexPattern CustomPattern(Pattern);
-		return FFileHelper::LoadFileToStringArrayWithPredicate(Lines, *Path, [CustomPattern](const FString& Line) {
-			FRegexMatcher CustomMatcher(CustomPattern, Line);
-			return CustomMatcher.FindNext();
+		const FFileHelperLineMatcher Matcher(Pattern, Mode);
+		Lines.Reset();
+		FString MatchedLine;
+		const FFileHelperLineReader::EResult Result = FFileHelperLineReader::VisitLines(*Path, [&Matcher, &Lines, &MatchedLine](FUtf8StringView Line)->bool{
+			if (Matcher.MatchLine(Line, MatchedLine))
+			{
+				Lines.Add(MoveTemp(MatchedLine));
+			}
+			return true;
+		});
+		if (Result != FFileHelperLineReader::EResult::UnsupportedEncoding)
+		{
+			return Result == FFileHelperLineReader::EResult::Success;
+		}
+		// UTF-16 files are not streamed
+		return FFileHelper::LoadFileToStringArrayWithPredicate(Lines, *Path, [&Matcher](const FString& Line) {
+			return Matcher.MatchLine(Line);
 		});
 	}
-	return FFileHelper::LoadFileToStringArray(Lines, *Path);
+	Lines.Reset();
+	return FFileHelperUtf8::VisitLines(Path, [&Lines](FUtf8StringView Line)->bool{
+		Lines.Emplace(Line.Len(), Line.GetData());
+		return true;
+	});
 }
 
 bool UFileHelperBPLibrary::ReadLineRange(FString Path, TArray<FString>& Lines, int32 StartIdx, int32 EndIdx)
@@ -160,7 +164,41 @@ bool UFileHelperBPLibrary::ReadLineRange(FString Path, TArray<FString>& Lines, i
 	{
 		return false;
 	}
+	Lines.Reset();
 	int32 LineCount = 0;
+	int64 StartOffset = 0;
+	// Seek directly to the first line when the file has an up to date line index
+	if (StartIdx > 0)
+	{
+		if (const TSharedPtr<const FFileHelperLineIndex> Index = FFileHelperLineIndex::Find(Path))
+		{
+			if (StartIdx >= Index->Num())
+			{
+				return true;
+			}
+			LineCount = StartIdx;
+			StartOffset = Index->GetLineOffset(StartIdx);
+		}
+	}
+	// Stream the file and stop reading once the range is done, only lines in range are converted
+	const FFileHelperLineReader::EResult Result = FFileHelperLineReader::VisitLines(*Path, [&Lines, &LineCount, StartIdx, EndIdx](FUtf8StringView Line)->bool{
+		if (EndIdx != INDEX_NONE && LineCount >= EndIdx)
+		{
+			return false;
+		}
+		if (LineCount >= StartIdx)
+		{
+			Lines.Emplace(Line.Len(), Line.GetData());
+		}
+		LineCount++;
+		return EndIdx == INDEX_NONE || LineCount < EndIdx;
+	}, StartOffset);
+	if (Result != FFileHelperLineReader::EResult::UnsupportedEncoding)
+	{
+		return Result == FFileHelperLineReader::EResult::Success;
+	}
+	// UTF-16 files are not streamed
+	LineCount = 0;
 	return FFileHelper::LoadFileToStringArrayWithPredicate(Lines, *Path, [&LineCount, StartIdx, EndIdx](const FString& Line)->bool{
 		const bool bRangeStart = LineCount >= StartIdx;
 		const bool bRangeEnd = EndIdx == INDEX_NONE || LineCount < EndIdx;
@@ -169,6 +207,59 @@ bool UFileHelperBPLibrary::ReadLineRange(FString Path, TArray<FString>& Lines, i
 	});
 }
 
+bool UFileHelperBPLibrary::BuildLineIndex(FString Path)
+{
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	if (!FileManager.FileExists(*Path))
+	{
+		return false;
+	}
+	return FFileHelperLineIndex::Build(Path);
+}
+
+bool UFileHelperBPLibrary::RemoveLineIndex(FString Path)
+{
+	return FFileHelperLineIndex::Remove(Path);
+}
+
+bool UFileHelperBPLibrary::ReadLineTail(FString Path, TArray<FString>& Lines, int32 Count)
+{
+	if (Count < 0)
+	{
+		return false;
+	}
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	if (!FileManager.FileExists(*Path))
+	{
+		return false;
+	}
+	Lines.Reset();
+	// Scan backwards from the end of the file, then read forward from there
+	int64 Offset = 0;
+	FFileHelperLineReader::EResult Result = FFileHelperLineReader::FindTailOffset(*Path, Count, Offset);
+	if (Result == FFileHelperLineReader::EResult::Success)
+	{
+		Result = FFileHelperLineReader::VisitLines(*Path, [&Lines](FUtf8StringView Line)->bool{
+			Lines.Emplace(Line.Len(), Line.GetData());
+			return true;
+		}, Offset);
+	}
+	if (Result != FFileHelperLineReader::EResult::UnsupportedEncoding)
+	{
+		return Result == FFileHelperLineReader::EResult::Success;
+	}
+	// UTF-16 files are not streamed
+	if (!FFileHelper::LoadFileToStringArray(Lines, *Path))
+	{
+		return false;
+	}
+	if (Lines.Num() > Count)
+	{
+		Lines.RemoveAt(0, Lines.Num() - Count);
+	}
+	return true;
+}
+
 bool UFileHelperBPLibrary::SaveLine(FString Path, const TArray<FString>& Text, FString& Error, bool Append, bool Force)
 {
 	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
@@ -196,17 +287,59 @@ bool UFileHelperBPLibrary::ReadByte(FString Path, TArray<uint8>& Bytes)
 	{
 		return false;
 	}
-	return FFileHelper::LoadFileToArray(Bytes, *Path);
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+	{
+		return false;
+	}
+	// Files written by SaveCompressedByte are decompressed transparently
+	if (FFileHelperCompression::IsCompressed(Bytes))
+	{
+		TArray<uint8> Decompressed;
+		if (!FFileHelperCompression::Decompress(Bytes, Decompressed))
+		{
+			Bytes.Reset();
+			return false;
+		}
+		Bytes = MoveTemp(Decompressed);
+	}
+	return true;
 }
 
-FString UFileHelperBPLibrary::BytesToBase64(const TArray<uint8> Bytes)
+FString UFileHelperBPLibrary::BytesToBase64(const TArray<uint8>& Bytes)
 {
-	return FBase64::Encode(Bytes);
+	return FFileHelperBase64::Encode(Bytes);
 }
 
-bool UFileHelperBPLibrary::BytesFromBase64(const FString Source, TArray<uint8>& Out)
+bool UFileHelperBPLibrary::BytesFromBase64(const FString& Source, TArray<uint8>& Out)
 {
-	return FBase64::Decode(Source, Out);
+	return FFileHelperBase64::Decode(FStringView(Source), Out);
+}
+
+bool UFileHelperBPLibrary::FileToBase64File(FString SourcePath, FString DestinationPath, FString& Error, bool Force)
+{
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	if (!FileManager.FileExists(*SourcePath))
+	{
+		Error = FString("File not found");
+		return false;
+	}
+	FText ErrorFilename;
+	if (!FFileHelper::IsFilenameValidForSaving(DestinationPath, ErrorFilename))
+	{
+		Error = FString("Filename is not valid");
+		return false;
+	}
+	if (FileManager.FileExists(*DestinationPath) && !Force)
+	{
+		Error = FString("File already exists");
+		return false;
+	}
+	if (!FFileHelperBase64::EncodeFile(SourcePath, DestinationPath))
+	{
+		Error = FString("File cannot be encoded");
+		return false;
+	}
+	return true;
 }
 
 bool UFileHelperBPLibrary::SaveByte(FString Path, const TArray<uint8>& Bytes, FString& Error, bool Append, bool Force)
@@ -229,104 +362,68 @@ bool UFileHelperBPLibrary::SaveByte(FString Path, const TArray<uint8>& Bytes, FS
 	return false;
 }
 
-bool UFileHelperBPLibrary::StringToCSV(FString Content, TArray<FString>& Headers, TArray<FString>& Data, int32& Total, bool HeaderFirst)
-{
-	const FCsvParser Parser(Content);
-	TArray<TArray<const TCHAR*>> Rows = Parser.GetRows();
-	for (TArray<const TCHAR*> Row : Rows)
-	{
-		Total++;
-		for (FString Col : Row)
-		{
-			if (Total == 1 && HeaderFirst)
-			{
-				Headers.Add(Col);
-			}
-			else
-			{
-				Data.Add(Col);
-			}
-		}
-	}
-	return true;
-	// auto Result = SplitString(Content, LINE_TERMINATOR, ESearchCase::Type::IgnoreCase);
-	// return UFileHelperBPLibrary::StringArrayToCSV(Result, Headers, Data, Total, HeaderFirst);
-}
-
-bool UFileHelperBPLibrary::CSVToString(FString& Output, TArray<FString> Headers, TArray<FString> Data, int32& Total)
+bool UFileHelperBPLibrary::SaveCompressedByte(FString Path, const TArray<uint8>& Bytes, FString& Error, EFileHelperCompressionCodec Codec, bool Force)
 {
-	Total = 0;
-	FString Delimiter = ",";
-	if (Headers.Num() == 0)
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	FText ErrorFilename;
+	if (!FFileHelper::IsFilenameValidForSaving(Path, ErrorFilename))
 	{
+		Error = FString("Filename is not valid");
 		return false;
 	}
-	if (Data.Num() % Headers.Num() != 0)
+	if (FileManager.FileExists(*Path) && !Force)
 	{
+		Error = FString("File already exists");
 		return false;
 	}
-	Output = TEXT("");
-	// Header row
-	for (FString Col : Headers)
+	TArray<uint8> Compressed;
+	if (!FFileHelperCompression::Compress(Bytes, Codec, Compressed))
 	{
-		if (Output.Len() > 0)
-		{
-			Output += Delimiter;
-		}
-		Output += (TEXT("\"") + Col.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\""));
-	}
-	Output += LINE_TERMINATOR;
-	FString Row = TEXT("");
-	int32 Count = 0;
-	// Data row
-	for (FString Col : Data)
-	{
-		Count++;
-		if (Row.Len() > 0)
-		{
-			Row += Delimiter;
-		}
-		Row += (TEXT("\"") + Col.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\""));
-		if (Count % Headers.Num() == 0)
-		{
-			Row += LINE_TERMINATOR;
-			Output += Row;
-			Row = "";
-		}
+		Error = FString("Bytes cannot be compressed");
+		return false;
 	}
-	Total = (Data.Num() / Headers.Num()) + 1;
-	return true;
+	return FFileHelper::SaveArrayToFile(Compressed, *Path);
 }
 
-bool UFileHelperBPLibrary::StringArrayToCSV(TArray<FString> Lines, TArray<FString>& Headers, TArray<FString>& Data, int32& Total, FString Delimiter, bool HeaderFirst)
+bool UFileHelperBPLibrary::HashFile(FString Path, FString& Hash, EFileHelperHashAlgorithm Algorithm)
 {
-	for (auto Line : Lines)
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	if (!FileManager.FileExists(*Path))
 	{
-		Total++;
-		if (!Line.Contains(TEXT("\"") + Delimiter + TEXT("\"")))
-		{
-			continue;
-		}
-		if (Total == 1 && HeaderFirst)
-		{
-			for (FString Col : UFileHelperBPLibrary::SplitString(Line, TEXT("\"") + Delimiter + TEXT("\""), ESearchCase::CaseSensitive))
-			{
-				Col.TrimQuotesInline();
-				Col.ReplaceInline(TEXT("\"\""), TEXT("\""));
-				Headers.Add(Col);
-			}
-		}
-		else
-		{
-			for (FString Col : UFileHelperBPLibrary::SplitString(Line, TEXT("\"") + Delimiter + TEXT("\""), ESearchCase::CaseSensitive))
-			{
-				Col.TrimQuotesInline();
-				Col.ReplaceInline(TEXT("\"\""), TEXT("\""));
-				Data.Add(Col);
-			}
-		}
+		return false;
 	}
-	return true;
+	return FFileHelperHash::HashFile(Path, Algorithm, Hash);
+}
+
+FString UFileHelperBPLibrary::HashBytes(const TArray<uint8>& Bytes, EFileHelperHashAlgorithm Algorithm)
+{
+	return FFileHelperHash::HashBytes(Bytes, Algorithm);
+}
+
+bool UFileHelperBPLibrary::FingerprintFile(FString Path, FString& Fingerprint)
+{
+	return FFileHelperHash::FingerprintFile(Path, Fingerprint);
+}
+
+bool UFileHelperBPLibrary::StringToCSV(FString Content, TArray<FString>& Headers, TArray<FString>& Data, int32& Total, bool HeaderFirst)
+{
+	return FFileHelperNative::StringToCSV(Content, Headers, Data, Total, HeaderFirst);
+}
+
+bool UFileHelperBPLibrary::StringToCSVQuery(const FString& Content, const TArray<FString>& Columns, const TArray<FFileHelperCSVFilter>& Filters, TArray<FString>& Headers, TArray<FString>& Data, int32& Total)
+{
+	return FFileHelperNative::StringToCSVQuery(Content, Columns, Filters, Headers, Data, Total);
+}
+
+bool UFileHelperBPLibrary::CSVToString(FString& Output, const TArray<FString>& Headers, const TArray<FString>& Data, int32& Total, bool QuoteAll)
+{
+	Output.Reset();
+	return FFileHelperNative::CSVToString(Output, Headers, Data, Total, QuoteAll);
+}
+
+bool UFileHelperBPLibrary::StringArrayToCSV(const TArray<FString>& Lines, TArray<FString>& Headers, TArray<FString>& Data, int32& Total, const FString& Delimiter, bool HeaderFirst)
+{
+	return FFileHelperNative::StringArrayToCSV(Lines, Headers, Data, Total, Delimiter, HeaderFirst);
 }
 
 bool UFileHelperBPLibrary::IsFile(FString Path)
@@ -602,7 +699,7 @@ void UFileHelperBPLibrary::GetPathParts(FString Path, FString& PathPart, FString
 	FileName = FPaths::GetCleanFilename(Path);
 }
 
-bool UFileHelperBPLibrary::DatatableToCSV(UDataTable* Table, FString& Output)
+bool UFileHelperBPLibrary::DatatableToCSV(UDataTable* Table, FString& Output, bool Parallel)
 {
 	if (Table == nullptr || !Table->RowStruct)
 	{
@@ -610,10 +707,10 @@ bool UFileHelperBPLibrary::DatatableToCSV(UDataTable* Table, FString& Output)
 	}
 
 	// See Table->GetTableAsCSV
-	return UFileHelperBPLibrary::WriteTableToCSV(*Table, Output);
+	return UFileHelperBPLibrary::WriteTableToCSV(*Table, Output, Parallel);
 }
 
-bool UFileHelperBPLibrary::DataTableToJSON(UDataTable* Table, FString& Output)
+bool UFileHelperBPLibrary::DataTableToJSON(UDataTable* Table, FString& Output, bool Parallel, bool Condensed)
 {
 	if (Table == nullptr || !Table->RowStruct)
 	{
@@ -621,7 +718,53 @@ bool UFileHelperBPLibrary::DataTableToJSON(UDataTable* Table, FString& Output)
 	}
 
 	// See Table->GetTableAsJSON
-	return UFileHelperBPLibrary::WriteTableToJSON(*Table, Output);
+	if (Condensed)
+	{
+		return UFileHelperBPLibrary::WriteTableToJSON<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>(*Table, Output, Parallel);
+	}
+	return UFileHelperBPLibrary::WriteTableToJSON<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>(*Table, Output, Parallel);
+}
+
+bool UFileHelperBPLibrary::DataTableToJSONFile(UDataTable* Table, const FString& Path, FString& Error, bool Parallel, bool Condensed, bool Force)
+{
+	if (Table == nullptr || !Table->RowStruct)
+	{
+		Error = FString("Datatable is not valid");
+		return false;
+	}
+	FText ErrorFilename;
+	if (!FFileHelper::IsFilenameValidForSaving(Path, ErrorFilename))
+	{
+		Error = FString("Filename is not valid");
+		return false;
+	}
+	if (!Force && FPlatformFileManager::Get().GetPlatformFile().FileExists(*Path))
+	{
+		Error = FString("File already exists");
+		return false;
+	}
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Path));
+	if (!Writer.IsValid())
+	{
+		Error = FString("File cannot be opened");
+		return false;
+	}
+	const bool bResult = Condensed
+		? UFileHelperBPLibrary::WriteTableToJSON<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>(*Table, *Writer, Parallel)
+		: UFileHelperBPLibrary::WriteTableToJSON<UTF8CHAR, TPrettyJsonPrintPolicy<UTF8CHAR>>(*Table, *Writer, Parallel);
+	return Writer->Close() && bResult;
+}
+
+bool UFileHelperBPLibrary::DataTableToJSONUtf8(const UDataTable& Table, TArray<uint8>& OutUtf8, bool bInParallel, bool bInCondensed)
+{
+	OutUtf8.Reset();
+	FMemoryWriter Writer(OutUtf8);
+	if (bInCondensed)
+	{
+		return UFileHelperBPLibrary::WriteTableToJSON<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>(Table, Writer, bInParallel);
+	}
+	return UFileHelperBPLibrary::WriteTableToJSON<UTF8CHAR, TPrettyJsonPrintPolicy<UTF8CHAR>>(Table, Writer, bInParallel);
 }
 
 UDataTable* UFileHelperBPLibrary::CSVToDataTable(FString CSV, UScriptStruct* Struct, bool& Success)
@@ -950,9 +1093,118 @@ bool UFileHelperBPLibrary::RemoveConfig(FString FilePath, FString Section, FStri
 	return SaveConfigFile(FilePath);
 }
 
+namespace FileHelperBPLibrary
+{
+	/** Tables with fewer rows per range are exported on the calling thread */
+	static constexpr int32 MinRowsPerRange = 256;
+
+	using FTableRow = TPair<FName, const uint8*>;
+
+	/** Rows of a table in map order cut into ranges of consecutive rows, a few ranges per worker thread, false when the table is too small to split */
+	bool SplitTableRows(const UDataTable& InDataTable, TArray<FTableRow>& OutRows, TArray<int32>& OutRangeStarts)
+	{
+		const TMap<FName, uint8*>& RowMap = InDataTable.GetRowMap();
+		const int32 RangeCount = FMath::Min(FTaskGraphInterface::Get().GetNumWorkerThreads() * 4, RowMap.Num() / MinRowsPerRange);
+		if (RangeCount < 2)
+		{
+			return false;
+		}
+
+		OutRows.Reserve(RowMap.Num());
+		for (const TPair<FName, uint8*>& Row : RowMap)
+		{
+			OutRows.Emplace(Row.Key, Row.Value);
+		}
+		for (int32 Range = 0; Range <= RangeCount; ++Range)
+		{
+			OutRangeStarts.Add(static_cast<int32>(static_cast<int64>(OutRows.Num()) * Range / RangeCount));
+		}
+		return true;
+	}
+
+	/** Json writer on a string, TCHAR only */
+	template <typename CharType, typename PrintPolicy>
+	TSharedRef<TJsonWriter<CharType, PrintPolicy>> CreateJsonWriter(FString& Output)
+	{
+		static_assert(std::is_same_v<CharType, TCHAR>, "Json written to a string must be TCHAR");
+		return TJsonWriterFactory<CharType, PrintPolicy>::Create(&Output);
+	}
+
+	/** Json writer on an archive, chars are serialized as CharType so UTF8CHAR gives UTF-8 text */
+	template <typename CharType, typename PrintPolicy>
+	TSharedRef<TJsonWriter<CharType, PrintPolicy>> CreateJsonWriter(FArchive& Output)
+	{
+		return TJsonWriterFactory<CharType, PrintPolicy>::Create(&Output);
+	}
+
+	/** Json of a range of rows exported in parallel, text for a string output, encoded chars for an archive output */
+	template <typename OutputType>
+	using TJsonBuffer = std::conditional_t<std::is_same_v<OutputType, FString>, FString, TArray<uint8>>;
+
+	/** What a range writer writes to, kept alive as long as its json writer */
+	template <typename OutputType>
+	struct TJsonBufferWriter
+	{
+		explicit TJsonBufferWriter(TArray<uint8>& InBuffer) : Writer(InBuffer) {}
+
+		FArchive& Get()
+		{
+			return Writer;
+		}
+
+		FMemoryWriter Writer;
+	};
+
+	template <>
+	struct TJsonBufferWriter<FString>
+	{
+		explicit TJsonBufferWriter(FString& InBuffer) : Buffer(InBuffer) {}
+
+		FString& Get()
+		{
+			return Buffer;
+		}
+
+		FString& Buffer;
+	};
+
+	template <typename CharType>
+	TConstArrayView<CharType> GetJsonChars(const FString& InBuffer)
+	{
+		return TConstArrayView<CharType>(InBuffer.GetCharArray().GetData(), InBuffer.Len());
+	}
+
+	template <typename CharType>
+	TConstArrayView<CharType> GetJsonChars(const TArray<uint8>& InBuffer)
+	{
+		return TConstArrayView<CharType>(reinterpret_cast<const CharType*>(InBuffer.GetData()), InBuffer.Num() / sizeof(CharType));
+	}
+
+	void ReserveJson(FString& Output, int64 InLength)
+	{
+		Output.Reserve(static_cast<int32>(FMath::Min<int64>(Output.Len() + InLength, MAX_int32)));
+	}
+
+	void ReserveJson(FArchive&, int64)
+	{
+		// Archives are written as they go
+	}
+
+	void AppendJson(FString& Output, const TCHAR* InChars, int32 InCount)
+	{
+		Output.AppendChars(InChars, InCount);
+	}
+
+	template <typename CharType>
+	void AppendJson(FArchive& Output, const CharType* InChars, int32 InCount)
+	{
+		Output.Serialize(const_cast<CharType*>(InChars), InCount * sizeof(CharType));
+	}
+}
+
 // equivalent GetTableAsCSV()
 
-bool UFileHelperBPLibrary::WriteTableToCSV(const UDataTable& InDataTable, FString& ExportedText)
+bool UFileHelperBPLibrary::WriteTableToCSV(const UDataTable& InDataTable, FString& ExportedText, bool bInParallel)
 {
 	if (!InDataTable.RowStruct)
 	{
@@ -972,38 +1224,61 @@ bool UFileHelperBPLibrary::WriteTableToCSV(const UDataTable& InDataTable, FStrin
 		ExportedText += TEXT("---");
 	}
 
-	FProperty* SkipProperty = nullptr;
-	for (TFieldIterator<FProperty> It(InDataTable.RowStruct); It; ++It)
+	// Resolved once, every row is written with the same plan
+	const TSharedRef<const FFileHelperExportPlan> Plan = FFileHelperExportPlan::Get(InDataTable.RowStruct);
+	for (const FFileHelperExportField& Field : Plan->GetFields())
 	{
-		FProperty* BaseProp = *It;
-		check(BaseProp);
-
-		FString ColumnHeader = DataTableUtils::GetPropertyExportName(BaseProp, EDataTableExportFlags::None);
-
-		if (ColumnHeader == ImportKeyField)
+		if (Field.CsvName == ImportKeyField)
 		{
-			// Don't write header again if this is the name field, and save for skipping later
-			SkipProperty = BaseProp;
+			// Don't write header again if this is the name field
 			continue;
 		}
 
 		ExportedText += TEXT(",");
-		ExportedText += ColumnHeader;
+		ExportedText += Field.CsvName;
 	}
 	ExportedText += TEXT("\n");
 
-	// Write each row
-	for (auto RowIt = InDataTable.GetRowMap().CreateConstIterator(); RowIt; ++RowIt)
+	auto WriteRow = [&Plan](FName InRowName, const uint8* InRowData, FString& OutText)
 	{
-		FName RowName = RowIt.Key();
-		ExportedText += RowName.ToString();
-
-		uint8* RowData = RowIt.Value();
-		UFileHelperBPLibrary::WriteRowToCSV(InDataTable.RowStruct, RowData, ExportedText);
+		OutText += InRowName.ToString();
+		UFileHelperBPLibrary::WriteRowToCSV(*Plan, InRowData, OutText);
+		OutText += TEXT("\n");
+	};
 
-		ExportedText += TEXT("\n");
+	TArray<FileHelperBPLibrary::FTableRow> Rows;
+	TArray<int32> RangeStarts;
+	if (!bInParallel || !FileHelperBPLibrary::SplitTableRows(InDataTable, Rows, RangeStarts))
+	{
+		// Write each row
+		for (auto RowIt = InDataTable.GetRowMap().CreateConstIterator(); RowIt; ++RowIt)
+		{
+			WriteRow(RowIt.Key(), RowIt.Value(), ExportedText);
+		}
+		return true;
 	}
 
+	// Each range of rows is written to its own buffer, buffers are appended in row order
+	TArray<FString> Buffers;
+	Buffers.SetNum(RangeStarts.Num() - 1);
+	ParallelFor(Buffers.Num(), [&](int32 Range)
+	{
+		for (int32 Row = RangeStarts[Range]; Row < RangeStarts[Range + 1]; ++Row)
+		{
+			WriteRow(Rows[Row].Key, Rows[Row].Value, Buffers[Range]);
+		}
+	}, EParallelForFlags::Unbalanced);
+
+	int32 Length = ExportedText.Len();
+	for (const FString& Buffer : Buffers)
+	{
+		Length += Buffer.Len();
+	}
+	ExportedText.Reserve(Length);
+	for (const FString& Buffer : Buffers)
+	{
+		ExportedText += Buffer;
+	}
 	return true;
 }
 
@@ -1014,13 +1289,15 @@ bool UFileHelperBPLibrary::WriteRowToCSV(const UScriptStruct* InRowStruct, const
 		return false;
 	}
 
-	for (TFieldIterator<FProperty> It(InRowStruct); It; ++It)
-	{
-		FProperty* BaseProp = *It;
-		check(BaseProp);
+	return UFileHelperBPLibrary::WriteRowToCSV(*FFileHelperExportPlan::Get(InRowStruct), InRowData, ExportedText);
+}
 
-		const void* Data = BaseProp->ContainerPtrToValuePtr<void>(InRowData, 0);
-		UFileHelperBPLibrary::WriteStructEntryToCSV(InRowData, BaseProp, Data, ExportedText);
+bool UFileHelperBPLibrary::WriteRowToCSV(const FFileHelperExportPlan& InPlan, const void* InRowData, FString& ExportedText)
+{
+	for (const FFileHelperExportField& Field : InPlan.GetFields())
+	{
+		const void* Data = Field.Property->ContainerPtrToValuePtr<void>(InRowData, 0);
+		UFileHelperBPLibrary::WriteStructEntryToCSV(InRowData, const_cast<FProperty*>(Field.Property), Data, ExportedText);
 	}
 
 	return true;
@@ -1053,43 +1330,101 @@ FString UFileHelperBPLibrary::GetKeyFieldName(const UDataTable& InDataTable)
 	}
 }
 
-bool UFileHelperBPLibrary::WriteTableToJSON(const UDataTable& InDataTable, FString& OutExportText)
+template <typename CharType, typename PrintPolicy, typename OutputType>
+bool UFileHelperBPLibrary::WriteTableToJSON(const UDataTable& InDataTable, OutputType& Output, bool bInParallel)
 {
+	using namespace FileHelperBPLibrary;
+
 	if (!InDataTable.RowStruct)
 	{
 		return false;
 	}
 
-	TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&OutExportText);
-
 	FString KeyField = UFileHelperBPLibrary::GetKeyFieldName(InDataTable);
 
-	JsonWriter->WriteArrayStart();
-
-	// Iterate over rows
-	for (auto RowIt = InDataTable.GetRowMap().CreateConstIterator(); RowIt; ++RowIt)
+	// Resolved once, every row is written with the same plan
+	const TSharedRef<const FFileHelperExportPlan> Plan = FFileHelperExportPlan::Get(InDataTable.RowStruct);
+	auto WriteRow = [&Plan, &KeyField](FName InRowName, const uint8* InRowData, TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter)
 	{
 		JsonWriter->WriteObjectStart();
 		{
 			// RowName
-			const FName RowName = RowIt.Key();
-			JsonWriter->WriteValue(KeyField, RowName.ToString());
+			JsonWriter->WriteValue(KeyField, InRowName.ToString());
 
 			// Now the values
-			uint8* RowData = RowIt.Value();
-			UFileHelperBPLibrary::WriteRowToJSON(InDataTable.RowStruct, RowData, JsonWriter);
+			UFileHelperBPLibrary::WriteStructToJSON(*Plan, InRowData, JsonWriter);
 		}
 		JsonWriter->WriteObjectEnd();
-	}
+	};
+
+	TArray<FTableRow> Rows;
+	TArray<int32> RangeStarts;
+	if (!bInParallel || !SplitTableRows(InDataTable, Rows, RangeStarts))
+	{
+		TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter = CreateJsonWriter<CharType, PrintPolicy>(Output);
+
+		JsonWriter->WriteArrayStart();
+
+		// Iterate over rows
+		for (auto RowIt = InDataTable.GetRowMap().CreateConstIterator(); RowIt; ++RowIt)
+		{
+			WriteRow(RowIt.Key(), RowIt.Value(), JsonWriter);
+		}
+
+		JsonWriter->WriteArrayEnd();
 
-	JsonWriter->WriteArrayEnd();
+		JsonWriter->Close();
 
-	JsonWriter->Close();
+		return true;
+	}
 
+	// Each range is written as a complete array by its own writer, so rows get the indentation of the serial export
+	TArray<TJsonBuffer<OutputType>> Buffers;
+	Buffers.SetNum(RangeStarts.Num() - 1);
+	ParallelFor(Buffers.Num(), [&](int32 Range)
+	{
+		TJsonBufferWriter<OutputType> BufferOutput(Buffers[Range]);
+		TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter = CreateJsonWriter<CharType, PrintPolicy>(BufferOutput.Get());
+		JsonWriter->WriteArrayStart();
+		for (int32 Row = RangeStarts[Range]; Row < RangeStarts[Range + 1]; ++Row)
+		{
+			WriteRow(Rows[Row].Key, Rows[Row].Value, JsonWriter);
+		}
+		JsonWriter->WriteArrayEnd();
+		JsonWriter->Close();
+	}, EParallelForFlags::Unbalanced);
+
+	// Every range array is "[" then its rows, each ending with "}", then the array end,
+	// the rows of all ranges are joined by "," inside the first "[" and the last array end
+	static const CharType ArrayStart = CharType('[');
+	static const CharType Separator = CharType(',');
+	int64 Length = 0;
+	for (const TJsonBuffer<OutputType>& Buffer : Buffers)
+	{
+		Length += GetJsonChars<CharType>(Buffer).Num();
+	}
+	ReserveJson(Output, Length);
+	AppendJson(Output, &ArrayStart, 1);
+	for (int32 Range = 0; Range < Buffers.Num(); ++Range)
+	{
+		const TConstArrayView<CharType> Chars = GetJsonChars<CharType>(Buffers[Range]);
+		const int32 RowsEnd = Chars.FindLastByPredicate([](CharType Char) { return Char == CharType('}'); }) + 1;
+		check(RowsEnd > 1 && Chars[0] == ArrayStart);
+		AppendJson(Output, Chars.GetData() + 1, RowsEnd - 1);
+		if (Range + 1 < Buffers.Num())
+		{
+			AppendJson(Output, &Separator, 1);
+		}
+		else
+		{
+			AppendJson(Output, Chars.GetData() + RowsEnd, Chars.Num() - RowsEnd);
+		}
+	}
 	return true;
 }
 
-bool UFileHelperBPLibrary::WriteTableAsObjectToJSON(const UDataTable& InDataTable, TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter)
+template <typename CharType, typename PrintPolicy>
+bool UFileHelperBPLibrary::WriteTableAsObjectToJSON(const UDataTable& InDataTable, TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter)
 {
 	if (!InDataTable.RowStruct)
 	{
@@ -1098,6 +1433,8 @@ bool UFileHelperBPLibrary::WriteTableAsObjectToJSON(const UDataTable& InDataTabl
 
 	JsonWriter->WriteObjectStart(InDataTable.GetName());
 
+	const TSharedRef<const FFileHelperExportPlan> Plan = FFileHelperExportPlan::Get(InDataTable.RowStruct);
+
 	// Iterate over rows
 	for (auto RowIt = InDataTable.GetRowMap().CreateConstIterator(); RowIt; ++RowIt)
 	{
@@ -1107,7 +1444,7 @@ bool UFileHelperBPLibrary::WriteTableAsObjectToJSON(const UDataTable& InDataTabl
 		{
 			// Now the values
 			uint8* RowData = RowIt.Value();
-			UFileHelperBPLibrary::WriteRowToJSON(InDataTable.RowStruct, RowData, JsonWriter);
+			UFileHelperBPLibrary::WriteStructToJSON(*Plan, RowData, JsonWriter);
 		}
 		JsonWriter->WriteObjectEnd();
 	}
@@ -1116,7 +1453,8 @@ bool UFileHelperBPLibrary::WriteTableAsObjectToJSON(const UDataTable& InDataTabl
 	return true;
 }
 
-bool UFileHelperBPLibrary::WriteRowToJSON(const UScriptStruct* InRowStruct, const void* InRowData, TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter)
+template <typename CharType, typename PrintPolicy>
+bool UFileHelperBPLibrary::WriteRowToJSON(const UScriptStruct* InRowStruct, const void* InRowData, TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter)
 {
 	if (!InRowStruct)
 	{
@@ -1126,28 +1464,31 @@ bool UFileHelperBPLibrary::WriteRowToJSON(const UScriptStruct* InRowStruct, cons
 	return UFileHelperBPLibrary::WriteStructToJSON(InRowStruct, InRowData, JsonWriter);
 }
 
-bool UFileHelperBPLibrary::WriteStructToJSON(const UScriptStruct* InStruct, const void* InStructData, TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter)
+template <typename CharType, typename PrintPolicy>
+bool UFileHelperBPLibrary::WriteStructToJSON(const UScriptStruct* InStruct, const void* InStructData, TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter)
 {
-	for (TFieldIterator<const FProperty> It(InStruct); It; ++It)
-	{
-		const FProperty* BaseProp = *It;
-		check(BaseProp);
-
-		const FString Identifier = DataTableUtils::GetPropertyExportName(BaseProp, EDataTableExportFlags::UseJsonObjectsForStructs);
+	return UFileHelperBPLibrary::WriteStructToJSON(*FFileHelperExportPlan::Get(InStruct), InStructData, JsonWriter);
+}
 
+template <typename CharType, typename PrintPolicy>
+bool UFileHelperBPLibrary::WriteStructToJSON(const FFileHelperExportPlan& InPlan, const void* InStructData, TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter)
+{
+	for (const FFileHelperExportField& Field : InPlan.GetFields())
+	{
+		const FProperty* BaseProp = Field.Property;
 		if (BaseProp->ArrayDim == 1)
 		{
 			const void* Data = BaseProp->ContainerPtrToValuePtr<void>(InStructData, 0);
-			UFileHelperBPLibrary::WriteStructEntryToJSON(InStructData, BaseProp, Data, JsonWriter);
+			UFileHelperBPLibrary::WriteStructEntryToJSON(InStructData, Field, Data, JsonWriter);
 		}
 		else
 		{
-			JsonWriter->WriteArrayStart(Identifier);
+			JsonWriter->WriteArrayStart(Field.JsonName);
 
 			for (int32 ArrayEntryIndex = 0; ArrayEntryIndex < BaseProp->ArrayDim; ++ArrayEntryIndex)
 			{
 				const void* Data = BaseProp->ContainerPtrToValuePtr<void>(InStructData, ArrayEntryIndex);
-				UFileHelperBPLibrary::WriteContainerEntryToJSON(BaseProp, Data, &Identifier, JsonWriter);
+				UFileHelperBPLibrary::WriteContainerEntryToJSON(BaseProp, Data, &Field.JsonName, JsonWriter);
 			}
 
 			JsonWriter->WriteArrayEnd();
@@ -1157,40 +1498,35 @@ bool UFileHelperBPLibrary::WriteStructToJSON(const UScriptStruct* InStruct, cons
 	return true;
 }
 
-bool UFileHelperBPLibrary::WriteStructEntryToJSON(const void* InRowData, const FProperty* InProperty, const void* InPropertyData, TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter)
+template <typename CharType, typename PrintPolicy>
+bool UFileHelperBPLibrary::WriteStructEntryToJSON(const void* InRowData, const FFileHelperExportField& InField, const void* InPropertyData, TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter)
 {
-	const FString Identifier = DataTableUtils::GetPropertyExportName(InProperty, EDataTableExportFlags::UseJsonObjectsForStructs);
+	const FString& Identifier = InField.JsonName;
+	const FProperty* InProperty = InField.Property;
 
-	if (const FEnumProperty* EnumProp = CastField<const FEnumProperty>(InProperty))
+	switch (InField.Kind)
 	{
-		const FString PropertyValue = DataTableUtils::GetPropertyValueAsString(EnumProp, (uint8*)InRowData, EDataTableExportFlags::UseJsonObjectsForStructs);
+	case EFileHelperExportKind::Integer:
+	{
+		const int64 PropertyValue = CastFieldChecked<const FNumericProperty>(InProperty)->GetSignedIntPropertyValue(InPropertyData);
 		JsonWriter->WriteValue(Identifier, PropertyValue);
+		break;
 	}
-	else if (const FNumericProperty* NumProp = CastField<const FNumericProperty>(InProperty))
+	case EFileHelperExportKind::Float:
 	{
-		if (NumProp->IsEnum())
-		{
-			const FString PropertyValue = DataTableUtils::GetPropertyValueAsString(InProperty, (uint8*)InRowData, EDataTableExportFlags::UseJsonObjectsForStructs);
-			JsonWriter->WriteValue(Identifier, PropertyValue);
-		}
-		else if (NumProp->IsInteger())
-		{
-			const int64 PropertyValue = NumProp->GetSignedIntPropertyValue(InPropertyData);
-			JsonWriter->WriteValue(Identifier, PropertyValue);
-		}
-		else
-		{
-			const double PropertyValue = NumProp->GetFloatingPointPropertyValue(InPropertyData);
-			JsonWriter->WriteValue(Identifier, PropertyValue);
-		}
+		const double PropertyValue = CastFieldChecked<const FNumericProperty>(InProperty)->GetFloatingPointPropertyValue(InPropertyData);
+		JsonWriter->WriteValue(Identifier, PropertyValue);
+		break;
 	}
-	else if (const FBoolProperty* BoolProp = CastField<const FBoolProperty>(InProperty))
+	case EFileHelperExportKind::Bool:
 	{
-		const bool PropertyValue = BoolProp->GetPropertyValue(InPropertyData);
+		const bool PropertyValue = CastFieldChecked<const FBoolProperty>(InProperty)->GetPropertyValue(InPropertyData);
 		JsonWriter->WriteValue(Identifier, PropertyValue);
+		break;
 	}
-	else if (const FArrayProperty* ArrayProp = CastField<const FArrayProperty>(InProperty))
+	case EFileHelperExportKind::Array:
 	{
+		const FArrayProperty* ArrayProp = CastFieldChecked<const FArrayProperty>(InProperty);
 		JsonWriter->WriteArrayStart(Identifier);
 
 		FScriptArrayHelper ArrayHelper(ArrayProp, InPropertyData);
@@ -1201,12 +1537,13 @@ bool UFileHelperBPLibrary::WriteStructEntryToJSON(const void* InRowData, const F
 		}
 
 		JsonWriter->WriteArrayEnd();
+		break;
 	}
-	else if (const FSetProperty* SetProp = CastField<const FSetProperty>(InProperty))
+	case EFileHelperExportKind::Set:
 	{
 		JsonWriter->WriteArrayStart(Identifier);
 
-		FScriptSetHelper SetHelper(SetProp, InPropertyData);
+		FScriptSetHelper SetHelper(CastFieldChecked<const FSetProperty>(InProperty), InPropertyData);
 		for (int32 SetSparseIndex = 0; SetSparseIndex < SetHelper.GetMaxIndex(); ++SetSparseIndex)
 		{
 			if (SetHelper.IsValidIndex(SetSparseIndex))
@@ -1217,12 +1554,13 @@ bool UFileHelperBPLibrary::WriteStructEntryToJSON(const void* InRowData, const F
 		}
 
 		JsonWriter->WriteArrayEnd();
+		break;
 	}
-	else if (const FMapProperty* MapProp = CastField<const FMapProperty>(InProperty))
+	case EFileHelperExportKind::Map:
 	{
 		JsonWriter->WriteObjectStart(Identifier);
 
-		FScriptMapHelper MapHelper(MapProp, InPropertyData);
+		FScriptMapHelper MapHelper(CastFieldChecked<const FMapProperty>(InProperty), InPropertyData);
 		for (int32 MapSparseIndex = 0; MapSparseIndex < MapHelper.GetMaxIndex(); ++MapSparseIndex)
 		{
 			if (MapHelper.IsValidIndex(MapSparseIndex))
@@ -1237,23 +1575,29 @@ bool UFileHelperBPLibrary::WriteStructEntryToJSON(const void* InRowData, const F
 		}
 
 		JsonWriter->WriteObjectEnd();
+		break;
 	}
-	else if (const FStructProperty* StructProp = CastField<const FStructProperty>(InProperty))
+	case EFileHelperExportKind::Struct:
 	{
 		JsonWriter->WriteObjectStart(Identifier);
-		UFileHelperBPLibrary::WriteStructToJSON(StructProp->Struct, InPropertyData, JsonWriter);
+		UFileHelperBPLibrary::WriteStructToJSON(*InField.StructPlan, InPropertyData, JsonWriter);
 		JsonWriter->WriteObjectEnd();
+		break;
 	}
-	else
+	default:
 	{
+		// Enums and other properties are exported as text
 		const FString PropertyValue = DataTableUtils::GetPropertyValueAsString(InProperty, (uint8*)InRowData, EDataTableExportFlags::UseJsonObjectsForStructs);
 		JsonWriter->WriteValue(Identifier, PropertyValue);
+		break;
+	}
 	}
 
 	return true;
 }
 
-bool UFileHelperBPLibrary::WriteContainerEntryToJSON(const FProperty* InProperty, const void* InPropertyData, const FString* InIdentifier, TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter)
+template <typename CharType, typename PrintPolicy>
+bool UFileHelperBPLibrary::WriteContainerEntryToJSON(const FProperty* InProperty, const void* InPropertyData, const FString* InIdentifier, TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter)
 {
 	if (const FEnumProperty* EnumProp = CastField<const FEnumProperty>(InProperty))
 	{
@@ -1313,7 +1657,8 @@ bool UFileHelperBPLibrary::WriteContainerEntryToJSON(const FProperty* InProperty
 	return true;
 }
 
-void UFileHelperBPLibrary::WriteJSONObjectStartWithOptionalIdentifier(TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter, const FString* InIdentifier)
+template <typename CharType, typename PrintPolicy>
+void UFileHelperBPLibrary::WriteJSONObjectStartWithOptionalIdentifier(TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter, const FString* InIdentifier)
 {
 	if (InIdentifier)
 	{
@@ -1325,7 +1670,8 @@ void UFileHelperBPLibrary::WriteJSONObjectStartWithOptionalIdentifier(TSharedRef
 	}
 }
 
-void UFileHelperBPLibrary::WriteJSONValueWithOptionalIdentifier(TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter, const FString* InIdentifier, const TCHAR* InValue)
+template <typename CharType, typename PrintPolicy>
+void UFileHelperBPLibrary::WriteJSONValueWithOptionalIdentifier(TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter, const FString* InIdentifier, const TCHAR* InValue)
 {
 	if (InIdentifier)
 	{
@@ -0,0 +1,497 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperBase64.h"
+
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+
+// SSSE3 code is always compiled on x86 and picked at runtime, default x64 targets only assume SSE2
+#if PLATFORM_CPU_X86_FAMILY
+#include <tmmintrin.h>
+#define FILEHELPER_BASE64_SSSE3 1
+#if defined(__clang__) || defined(__GNUC__)
+#define FILEHELPER_BASE64_SSSE3_TARGET __attribute__((target("ssse3")))
+#else
+#include <intrin.h>
+#define FILEHELPER_BASE64_SSSE3_TARGET
+#endif
+#else
+#define FILEHELPER_BASE64_SSSE3 0
+#endif
+
+#if !FILEHELPER_BASE64_SSSE3 && PLATFORM_ENABLE_VECTORINTRINSICS_NEON && PLATFORM_64BITS
+#include <arm_neon.h>
+#define FILEHELPER_BASE64_NEON 1
+#else
+#define FILEHELPER_BASE64_NEON 0
+#endif
+
+namespace FileHelperBase64
+{
+	static constexpr uint8 InvalidValue = 0xFF;
+
+	static const uint8 EncodeTable[64] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+		'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+		'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
+	};
+
+	struct FDecodeTable
+	{
+		uint8 Values[256];
+
+		FDecodeTable()
+		{
+			FMemory::Memset(Values, InvalidValue, sizeof(Values));
+			for (uint8 Index = 0; Index < 64; ++Index)
+			{
+				Values[EncodeTable[Index]] = Index;
+			}
+		}
+	};
+
+	static const FDecodeTable DecodeTable;
+
+	/** Characters above 0xFF are mapped to an invalid byte */
+	template <typename CharType>
+	FORCEINLINE uint8 ToByte(CharType InChar)
+	{
+		return static_cast<uint32>(InChar) > 0xFF ? 0xFF : static_cast<uint8>(InChar);
+	}
+
+	template <typename CharType>
+	void EncodeScalar(const uint8* In, int64 InSize, CharType* Out)
+	{
+		int64 Pos = 0;
+		for (; Pos + 3 <= InSize; Pos += 3, Out += 4)
+		{
+			const uint32 Triplet = (In[Pos] << 16) | (In[Pos + 1] << 8) | In[Pos + 2];
+			Out[0] = static_cast<CharType>(EncodeTable[(Triplet >> 18) & 0x3F]);
+			Out[1] = static_cast<CharType>(EncodeTable[(Triplet >> 12) & 0x3F]);
+			Out[2] = static_cast<CharType>(EncodeTable[(Triplet >> 6) & 0x3F]);
+			Out[3] = static_cast<CharType>(EncodeTable[Triplet & 0x3F]);
+		}
+
+		const int64 Remaining = InSize - Pos;
+		if (Remaining > 0)
+		{
+			const uint32 Triplet = (In[Pos] << 16) | (Remaining > 1 ? In[Pos + 1] << 8 : 0);
+			Out[0] = static_cast<CharType>(EncodeTable[(Triplet >> 18) & 0x3F]);
+			Out[1] = static_cast<CharType>(EncodeTable[(Triplet >> 12) & 0x3F]);
+			Out[2] = static_cast<CharType>(Remaining > 1 ? EncodeTable[(Triplet >> 6) & 0x3F] : '=');
+			Out[3] = static_cast<CharType>('=');
+		}
+	}
+
+	/** Decodes full quads, the last quad may be padded, returns false on invalid input */
+	template <typename CharType>
+	bool DecodeScalar(const CharType* In, int64 InLen, uint8* Out)
+	{
+		for (int64 Pos = 0; Pos < InLen; Pos += 4)
+		{
+			const bool bLast = Pos + 4 == InLen;
+			const uint8 A = DecodeTable.Values[ToByte(In[Pos])];
+			const uint8 B = DecodeTable.Values[ToByte(In[Pos + 1])];
+			const bool bPad2 = bLast && In[Pos + 2] == '=' && In[Pos + 3] == '=';
+			const bool bPad3 = bLast && !bPad2 && In[Pos + 3] == '=';
+			const uint8 C = bPad2 ? 0 : DecodeTable.Values[ToByte(In[Pos + 2])];
+			const uint8 D = (bPad2 || bPad3) ? 0 : DecodeTable.Values[ToByte(In[Pos + 3])];
+			if (A == InvalidValue || B == InvalidValue || C == InvalidValue || D == InvalidValue)
+			{
+				return false;
+			}
+
+			const uint32 Triplet = (A << 18) | (B << 12) | (C << 6) | D;
+			*Out++ = static_cast<uint8>(Triplet >> 16);
+			if (!bPad2)
+			{
+				*Out++ = static_cast<uint8>(Triplet >> 8);
+				if (!bPad3)
+				{
+					*Out++ = static_cast<uint8>(Triplet);
+				}
+			}
+		}
+		return true;
+	}
+
+#if FILEHELPER_BASE64_SSSE3
+	bool HasSSSE3()
+	{
+#if defined(PLATFORM_ALWAYS_HAS_SSE4_1) && PLATFORM_ALWAYS_HAS_SSE4_1
+		return true;
+#elif defined(__clang__) || defined(__GNUC__)
+		static const bool bHasSSSE3 = __builtin_cpu_supports("ssse3");
+		return bHasSSSE3;
+#else
+		static const bool bHasSSSE3 = []()
+		{
+			int Info[4];
+			__cpuid(Info, 1);
+			return (Info[2] & (1 << 9)) != 0;
+		}();
+		return bHasSSSE3;
+#endif
+	}
+
+	/** Encodes the first 12 bytes of a block into 16 characters */
+	FORCEINLINE FILEHELPER_BASE64_SSSE3_TARGET __m128i EncodeBlock(__m128i InBytes)
+	{
+		// Spread 3 bytes on 4 lanes, then move each 6 bits index to its own byte
+		const __m128i Shuffled = _mm_shuffle_epi8(InBytes, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+		const __m128i T0 = _mm_and_si128(Shuffled, _mm_set1_epi32(0x0FC0FC00));
+		const __m128i T1 = _mm_mulhi_epu16(T0, _mm_set1_epi32(0x04000040));
+		const __m128i T2 = _mm_and_si128(Shuffled, _mm_set1_epi32(0x003F03F0));
+		const __m128i T3 = _mm_mullo_epi16(T2, _mm_set1_epi32(0x01000010));
+		const __m128i Indices = _mm_or_si128(T1, T3);
+
+		// Offset from the index to its character, selected by range
+		__m128i Range = _mm_subs_epu8(Indices, _mm_set1_epi8(51));
+		const __m128i Lower = _mm_cmpgt_epi8(_mm_set1_epi8(26), Indices);
+		Range = _mm_or_si128(Range, _mm_and_si128(Lower, _mm_set1_epi8(13)));
+		const __m128i Offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+		return _mm_add_epi8(_mm_shuffle_epi8(Offsets, Range), Indices);
+	}
+
+	/** Decodes 16 characters into 12 bytes at the start of the result, returns false when a character is not in the alphabet */
+	FORCEINLINE FILEHELPER_BASE64_SSSE3_TARGET bool DecodeBlock(__m128i InChars, __m128i& OutBytes)
+	{
+		const __m128i HighNibble = _mm_and_si128(_mm_srli_epi32(InChars, 4), _mm_set1_epi8(0x0F));
+		const __m128i LowNibble = _mm_and_si128(InChars, _mm_set1_epi8(0x0F));
+
+		// Each low nibble has a bit set for every valid high nibble
+		const __m128i ValidMask = _mm_setr_epi8(
+			static_cast<char>(0xA8), static_cast<char>(0xF8), static_cast<char>(0xF8), static_cast<char>(0xF8),
+			static_cast<char>(0xF8), static_cast<char>(0xF8), static_cast<char>(0xF8), static_cast<char>(0xF8),
+			static_cast<char>(0xF8), static_cast<char>(0xF8), static_cast<char>(0xF0), 0x54,
+			0x50, 0x50, 0x50, 0x54);
+		const __m128i HighBit = _mm_setr_epi8(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, static_cast<char>(0x80), 0, 0, 0, 0, 0, 0, 0, 0);
+		const __m128i Valid = _mm_and_si128(_mm_shuffle_epi8(ValidMask, LowNibble), _mm_shuffle_epi8(HighBit, HighNibble));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(Valid, _mm_setzero_si128())) != 0)
+		{
+			return false;
+		}
+
+		// '/' shares its high nibble with '+' and needs 3 less
+		const __m128i Shifts = _mm_setr_epi8(0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+		const __m128i Slash = _mm_and_si128(_mm_cmpeq_epi8(InChars, _mm_set1_epi8('/')), _mm_set1_epi8(-3));
+		const __m128i Values = _mm_add_epi8(InChars, _mm_add_epi8(_mm_shuffle_epi8(Shifts, HighNibble), Slash));
+
+		// Merge 4 values of 6 bits into 3 bytes per lane
+		const __m128i Merged = _mm_madd_epi16(_mm_maddubs_epi16(Values, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+		OutBytes = _mm_shuffle_epi8(Merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+		return true;
+	}
+
+	template <typename CharType>
+	FORCEINLINE FILEHELPER_BASE64_SSSE3_TARGET void StoreChars(CharType* Out, __m128i InChars)
+	{
+		if constexpr (sizeof(CharType) == 1)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), InChars);
+		}
+		else if constexpr (sizeof(CharType) == 2)
+		{
+			const __m128i Zero = _mm_setzero_si128();
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), _mm_unpacklo_epi8(InChars, Zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + 8), _mm_unpackhi_epi8(InChars, Zero));
+		}
+		else
+		{
+			alignas(16) uint8 Chars[16];
+			_mm_store_si128(reinterpret_cast<__m128i*>(Chars), InChars);
+			for (int32 Index = 0; Index < 16; ++Index)
+			{
+				Out[Index] = static_cast<CharType>(Chars[Index]);
+			}
+		}
+	}
+
+	template <typename CharType>
+	FORCEINLINE FILEHELPER_BASE64_SSSE3_TARGET __m128i LoadChars(const CharType* In)
+	{
+		if constexpr (sizeof(CharType) == 1)
+		{
+			return _mm_loadu_si128(reinterpret_cast<const __m128i*>(In));
+		}
+		else if constexpr (sizeof(CharType) == 2)
+		{
+			// Saturation turns characters above 0xFF into 0xFF which is rejected
+			return _mm_packus_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(In)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(In + 8)));
+		}
+		else
+		{
+			alignas(16) uint8 Chars[16];
+			for (int32 Index = 0; Index < 16; ++Index)
+			{
+				Chars[Index] = ToByte(In[Index]);
+			}
+			return _mm_load_si128(reinterpret_cast<const __m128i*>(Chars));
+		}
+	}
+
+	/** Encodes whole blocks, returns the number of bytes consumed and moves Out past the characters written */
+	template <typename CharType>
+	FILEHELPER_BASE64_SSSE3_TARGET int64 EncodeSSSE3(const uint8* In, int64 InSize, CharType*& Out)
+	{
+		// 16 bytes are loaded for every 12 encoded
+		int64 Pos = 0;
+		for (; Pos + 16 <= InSize; Pos += 12, Out += 16)
+		{
+			StoreChars(Out, EncodeBlock(_mm_loadu_si128(reinterpret_cast<const __m128i*>(In + Pos))));
+		}
+		return Pos;
+	}
+
+	/** Decodes whole blocks until the last quad or an invalid character, returns the number of characters consumed and moves Out past the bytes written */
+	template <typename CharType>
+	FILEHELPER_BASE64_SSSE3_TARGET int64 DecodeSSSE3(const CharType* In, int64 InLen, uint8*& Out)
+	{
+		int64 Pos = 0;
+		for (; Pos + 16 <= InLen - 4; Pos += 16, Out += 12)
+		{
+			__m128i Bytes;
+			if (!DecodeBlock(LoadChars(In + Pos), Bytes))
+			{
+				break;
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), Bytes);
+		}
+		return Pos;
+	}
+#elif FILEHELPER_BASE64_NEON
+	FORCEINLINE uint8x16x4_t LoadTable(const uint8* InTable)
+	{
+		uint8x16x4_t Table;
+		Table.val[0] = vld1q_u8(InTable);
+		Table.val[1] = vld1q_u8(InTable + 16);
+		Table.val[2] = vld1q_u8(InTable + 32);
+		Table.val[3] = vld1q_u8(InTable + 48);
+		return Table;
+	}
+
+	/** Encodes 48 bytes into 64 characters */
+	FORCEINLINE uint8x16x4_t EncodeBlock(const uint8* In, const uint8x16x4_t& InTable)
+	{
+		const uint8x16x3_t Bytes = vld3q_u8(In);
+		uint8x16x4_t Indices;
+		Indices.val[0] = vshrq_n_u8(Bytes.val[0], 2);
+		Indices.val[1] = vorrq_u8(vshlq_n_u8(vandq_u8(Bytes.val[0], vdupq_n_u8(0x03)), 4), vshrq_n_u8(Bytes.val[1], 4));
+		Indices.val[2] = vorrq_u8(vshlq_n_u8(vandq_u8(Bytes.val[1], vdupq_n_u8(0x0F)), 2), vshrq_n_u8(Bytes.val[2], 6));
+		Indices.val[3] = vandq_u8(Bytes.val[2], vdupq_n_u8(0x3F));
+
+		uint8x16x4_t Chars;
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			Chars.val[Index] = vqtbl4q_u8(InTable, Indices.val[Index]);
+		}
+		return Chars;
+	}
+
+	/** Decodes 64 characters into 48 bytes, returns false when a character is not in the alphabet */
+	FORCEINLINE bool DecodeBlock(const uint8* In, uint8* Out, const uint8x16x4_t& InLowTable, const uint8x16x4_t& InHighTable)
+	{
+		const uint8x16x4_t Chars = vld4q_u8(In);
+		uint8x16x4_t Values;
+		uint8x16_t Invalid = vdupq_n_u8(0);
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			// Characters 0-63 from the low table, 64-127 from the high table, above is invalid
+			uint8x16_t Value = vqtbl4q_u8(InLowTable, Chars.val[Index]);
+			Value = vqtbx4q_u8(Value, InHighTable, vsubq_u8(Chars.val[Index], vdupq_n_u8(64)));
+			Value = vorrq_u8(Value, vcgeq_u8(Chars.val[Index], vdupq_n_u8(128)));
+			Invalid = vorrq_u8(Invalid, Value);
+			Values.val[Index] = Value;
+		}
+		if (vmaxvq_u8(Invalid) > 63)
+		{
+			return false;
+		}
+
+		uint8x16x3_t Bytes;
+		Bytes.val[0] = vorrq_u8(vshlq_n_u8(Values.val[0], 2), vshrq_n_u8(Values.val[1], 4));
+		Bytes.val[1] = vorrq_u8(vshlq_n_u8(Values.val[1], 4), vshrq_n_u8(Values.val[2], 2));
+		Bytes.val[2] = vorrq_u8(vshlq_n_u8(Values.val[2], 6), Values.val[3]);
+		vst3q_u8(Out, Bytes);
+		return true;
+	}
+#endif
+
+	template <typename CharType>
+	void Encode(const uint8* In, int64 InSize, CharType* Out)
+	{
+		int64 Pos = 0;
+#if FILEHELPER_BASE64_SSSE3
+		if (HasSSSE3())
+		{
+			Pos = EncodeSSSE3(In, InSize, Out);
+		}
+#elif FILEHELPER_BASE64_NEON
+		const uint8x16x4_t Table = LoadTable(EncodeTable);
+		for (; Pos + 48 <= InSize; Pos += 48, Out += 64)
+		{
+			const uint8x16x4_t Chars = EncodeBlock(In + Pos, Table);
+			if constexpr (sizeof(CharType) == 1)
+			{
+				vst4q_u8(reinterpret_cast<uint8*>(Out), Chars);
+			}
+			else
+			{
+				uint8 Block[64];
+				vst4q_u8(Block, Chars);
+				for (int32 Index = 0; Index < 64; ++Index)
+				{
+					Out[Index] = static_cast<CharType>(Block[Index]);
+				}
+			}
+		}
+#endif
+		EncodeScalar(In + Pos, InSize - Pos, Out);
+	}
+
+	template <typename CharType>
+	bool Decode(const CharType* In, int64 InLen, TArray<uint8>& OutBytes)
+	{
+		OutBytes.Reset();
+		if (InLen % 4 != 0)
+		{
+			return false;
+		}
+		if (InLen == 0)
+		{
+			return true;
+		}
+
+		const int64 Padding = (In[InLen - 1] == '=') + (In[InLen - 2] == '=');
+		const int64 OutSize = InLen / 4 * 3 - Padding;
+		if (OutSize > MAX_int32 - 16)
+		{
+			return false;
+		}
+		// Vector stores may write a few bytes past the decoded ones
+		OutBytes.SetNumUninitialized(static_cast<int32>(OutSize) + 16);
+		uint8* Out = OutBytes.GetData();
+
+		// The last quad is left to the scalar code as it may be padded
+		int64 Pos = 0;
+#if FILEHELPER_BASE64_SSSE3
+		if (HasSSSE3())
+		{
+			Pos = DecodeSSSE3(In, InLen, Out);
+		}
+#elif FILEHELPER_BASE64_NEON
+		static const uint8x16x4_t LowTable = LoadTable(DecodeTable.Values);
+		static const uint8x16x4_t HighTable = LoadTable(DecodeTable.Values + 64);
+		for (; Pos + 64 <= InLen - 4; Pos += 64, Out += 48)
+		{
+			if constexpr (sizeof(CharType) == 1)
+			{
+				if (!DecodeBlock(reinterpret_cast<const uint8*>(In + Pos), Out, LowTable, HighTable))
+				{
+					break;
+				}
+			}
+			else
+			{
+				uint8 Block[64];
+				for (int32 Index = 0; Index < 64; ++Index)
+				{
+					Block[Index] = ToByte(In[Pos + Index]);
+				}
+				if (!DecodeBlock(Block, Out, LowTable, HighTable))
+				{
+					break;
+				}
+			}
+		}
+#endif
+		// Invalid characters found by the vector code are reported by the scalar code
+		if (!DecodeScalar(In + Pos, InLen - Pos, Out))
+		{
+			OutBytes.Reset();
+			return false;
+		}
+		OutBytes.SetNum(static_cast<int32>(OutSize), EAllowShrinking::No);
+		return true;
+	}
+}
+
+void FFileHelperBase64::Encode(TConstArrayView64<uint8> InBytes, TCHAR* Out)
+{
+	FileHelperBase64::Encode(InBytes.GetData(), InBytes.Num(), Out);
+}
+
+void FFileHelperBase64::Encode(TConstArrayView64<uint8> InBytes, UTF8CHAR* Out)
+{
+	FileHelperBase64::Encode(InBytes.GetData(), InBytes.Num(), reinterpret_cast<uint8*>(Out));
+}
+
+FString FFileHelperBase64::Encode(TConstArrayView64<uint8> InBytes)
+{
+	const int64 Length = GetEncodedLength(InBytes.Num());
+	if (Length == 0 || Length >= MAX_int32)
+	{
+		return FString();
+	}
+	FString Result;
+	TArray<TCHAR>& Chars = Result.GetCharArray();
+	Chars.SetNumUninitialized(static_cast<int32>(Length) + 1);
+	Encode(InBytes, Chars.GetData());
+	Chars[static_cast<int32>(Length)] = TEXT('\0');
+	return Result;
+}
+
+bool FFileHelperBase64::Decode(FStringView InSource, TArray<uint8>& OutBytes)
+{
+	return FileHelperBase64::Decode(InSource.GetData(), InSource.Len(), OutBytes);
+}
+
+bool FFileHelperBase64::Decode(FUtf8StringView InSource, TArray<uint8>& OutBytes)
+{
+	return FileHelperBase64::Decode(reinterpret_cast<const uint8*>(InSource.GetData()), InSource.Len(), OutBytes);
+}
+
+bool FFileHelperBase64::EncodeFile(const FString& InSourcePath, const FString& InDestinationPath)
+{
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	TUniquePtr<IFileHandle> Source(FileManager.OpenRead(*InSourcePath));
+	if (!Source.IsValid())
+	{
+		return false;
+	}
+	const FString Directory = FPaths::GetPath(InDestinationPath);
+	if (!Directory.IsEmpty() && !FileManager.DirectoryExists(*Directory))
+	{
+		FileManager.CreateDirectoryTree(*Directory);
+	}
+	TUniquePtr<IFileHandle> Destination(FileManager.OpenWrite(*InDestinationPath));
+	if (!Destination.IsValid())
+	{
+		return false;
+	}
+
+	// Chunks are a multiple of 3 bytes so only the last one is padded
+	constexpr int64 ChunkSize = 3 * 64 * 1024;
+	const int64 FileSize = Source->Size();
+	TArray<uint8> Bytes;
+	Bytes.SetNumUninitialized(static_cast<int32>(FMath::Min(ChunkSize, FMath::Max<int64>(FileSize, 1))));
+	TArray<uint8> Chars;
+	Chars.SetNumUninitialized(static_cast<int32>(GetEncodedLength(Bytes.Num())));
+
+	for (int64 Offset = 0; Offset < FileSize;)
+	{
+		const int64 ReadSize = FMath::Min<int64>(Bytes.Num(), FileSize - Offset);
+		if (!Source->Read(Bytes.GetData(), ReadSize))
+		{
+			return false;
+		}
+		FileHelperBase64::Encode(Bytes.GetData(), ReadSize, Chars.GetData());
+		if (!Destination->Write(Chars.GetData(), GetEncodedLength(ReadSize)))
+		{
+			return false;
+		}
+		Offset += ReadSize;
+	}
+	return Destination->Flush();
+}
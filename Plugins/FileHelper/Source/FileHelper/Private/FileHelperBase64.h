@@ -0,0 +1,33 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Standard base64 codec (RFC 4648 alphabet with padding) compatible with FBase64,
+ * blocks of 12 bytes (SSSE3) or 48 bytes (NEON) are encoded and decoded per step, tails and padding are handled by scalar code
+ */
+class FFileHelperBase64
+{
+public:
+	/** Number of characters needed to encode a number of bytes */
+	static int64 GetEncodedLength(int64 InSize)
+	{
+		return ((InSize + 2) / 3) * 4;
+	}
+
+	/** Encodes bytes to base64, Out must hold GetEncodedLength characters */
+	static void Encode(TConstArrayView64<uint8> InBytes, TCHAR* Out);
+	static void Encode(TConstArrayView64<uint8> InBytes, UTF8CHAR* Out);
+
+	/** Encodes bytes to a base64 string */
+	static FString Encode(TConstArrayView64<uint8> InBytes);
+
+	/** Decodes base64 text, fails on invalid characters or length */
+	static bool Decode(FStringView InSource, TArray<uint8>& OutBytes);
+	static bool Decode(FUtf8StringView InSource, TArray<uint8>& OutBytes);
+
+	/** Encodes a file to a base64 text file in bounded chunks, the payload is never fully loaded */
+	static bool EncodeFile(const FString& InSourcePath, const FString& InDestinationPath);
+};
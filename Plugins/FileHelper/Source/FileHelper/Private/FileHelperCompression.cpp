@@ -0,0 +1,205 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperCompression.h"
+
+#include "Async/ParallelFor.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include <atomic>
+
+namespace FileHelperCompression
+{
+	static constexpr uint32 Magic = 0x5A434846; // FHCZ
+	static constexpr uint32 Version = 1;
+	static constexpr uint32 RawBlockFlag = 0x80000000;
+
+	/** Magic, version, codec, block size, uncompressed size and block count */
+	static constexpr int64 FixedHeaderSize = sizeof(uint32) + sizeof(uint32) + sizeof(uint8) + sizeof(int32) + sizeof(int64) + sizeof(int32);
+}
+
+FName FFileHelperCompression::GetFormatName(EFileHelperCompressionCodec InCodec)
+{
+	switch (InCodec)
+	{
+	case EFileHelperCompressionCodec::Zlib:
+		return NAME_Zlib;
+	case EFileHelperCompressionCodec::LZ4:
+		return NAME_LZ4;
+	case EFileHelperCompressionCodec::Oodle:
+	default:
+		return NAME_Oodle;
+	}
+}
+
+bool FFileHelperCompression::Compress(TConstArrayView<uint8> InData, EFileHelperCompressionCodec InCodec, TArray<uint8>& OutData)
+{
+	using namespace FileHelperCompression;
+
+	const FName Format = GetFormatName(InCodec);
+	const int32 BlockCount = FMath::DivideAndRoundUp(InData.Num(), BlockSize);
+
+	// Empty block means the block did not shrink and is stored raw
+	TArray<TArray<uint8>> Blocks;
+	Blocks.SetNum(BlockCount);
+	ParallelFor(BlockCount, [&](int32 BlockIndex)
+	{
+		const int32 Offset = BlockIndex * BlockSize;
+		const int32 Size = FMath::Min(BlockSize, InData.Num() - Offset);
+		TArray<uint8>& Block = Blocks[BlockIndex];
+		int32 CompressedSize = FCompression::CompressMemoryBound(Format, Size);
+		Block.SetNumUninitialized(CompressedSize);
+		if (FCompression::CompressMemory(Format, Block.GetData(), CompressedSize, InData.GetData() + Offset, Size) && CompressedSize < Size)
+		{
+			Block.SetNum(CompressedSize, EAllowShrinking::No);
+		}
+		else
+		{
+			Block.Empty();
+		}
+	});
+
+	OutData.Reset();
+	FMemoryWriter Writer(OutData);
+	uint32 HeaderMagic = Magic;
+	uint32 HeaderVersion = Version;
+	uint8 Codec = static_cast<uint8>(InCodec);
+	int32 HeaderBlockSize = BlockSize;
+	int64 UncompressedSize = InData.Num();
+	int32 HeaderBlockCount = BlockCount;
+	Writer << HeaderMagic << HeaderVersion << Codec << HeaderBlockSize << UncompressedSize << HeaderBlockCount;
+
+	int64 DataSize = 0;
+	for (int32 BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
+	{
+		const int32 RawSize = FMath::Min(BlockSize, InData.Num() - BlockIndex * BlockSize);
+		uint32 StoredSize = Blocks[BlockIndex].IsEmpty() ? (static_cast<uint32>(RawSize) | RawBlockFlag) : static_cast<uint32>(Blocks[BlockIndex].Num());
+		Writer << StoredSize;
+		DataSize += StoredSize & ~RawBlockFlag;
+	}
+
+	if (OutData.Num() + DataSize > MAX_int32)
+	{
+		OutData.Reset();
+		return false;
+	}
+
+	OutData.Reserve(OutData.Num() + static_cast<int32>(DataSize));
+	for (int32 BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
+	{
+		if (Blocks[BlockIndex].IsEmpty())
+		{
+			const int32 Offset = BlockIndex * BlockSize;
+			OutData.Append(InData.GetData() + Offset, FMath::Min(BlockSize, InData.Num() - Offset));
+		}
+		else
+		{
+			OutData.Append(Blocks[BlockIndex]);
+		}
+	}
+	return !Writer.IsError();
+}
+
+bool FFileHelperCompression::ReadHeader(TConstArrayView<uint8> InData, FHeader& OutHeader)
+{
+	using namespace FileHelperCompression;
+
+	if (InData.Num() < FixedHeaderSize)
+	{
+		return false;
+	}
+
+	FMemoryReaderView Reader(InData);
+	uint32 HeaderMagic = 0;
+	uint32 HeaderVersion = 0;
+	uint8 Codec = 0;
+	int32 HeaderBlockSize = 0;
+	int64 UncompressedSize = 0;
+	int32 BlockCount = 0;
+	Reader << HeaderMagic << HeaderVersion << Codec << HeaderBlockSize << UncompressedSize << BlockCount;
+
+	if (Reader.IsError() || HeaderMagic != Magic || HeaderVersion != Version || Codec > static_cast<uint8>(EFileHelperCompressionCodec::LZ4)
+		|| HeaderBlockSize != BlockSize || UncompressedSize < 0 || UncompressedSize > MAX_int32
+		|| BlockCount != FMath::DivideAndRoundUp(static_cast<int32>(UncompressedSize), BlockSize))
+	{
+		return false;
+	}
+
+	const int64 TableSize = static_cast<int64>(BlockCount) * sizeof(uint32);
+	if (FixedHeaderSize + TableSize > InData.Num())
+	{
+		return false;
+	}
+
+	OutHeader.Codec = static_cast<EFileHelperCompressionCodec>(Codec);
+	OutHeader.UncompressedSize = UncompressedSize;
+	OutHeader.BlockSizes.SetNumUninitialized(BlockCount);
+	OutHeader.DataOffset = FixedHeaderSize + TableSize;
+
+	int64 DataSize = 0;
+	for (uint32& StoredSize : OutHeader.BlockSizes)
+	{
+		Reader << StoredSize;
+		DataSize += StoredSize & ~RawBlockFlag;
+	}
+
+	return OutHeader.DataOffset + DataSize == InData.Num();
+}
+
+bool FFileHelperCompression::IsCompressed(TConstArrayView<uint8> InData)
+{
+	FHeader Header;
+	return ReadHeader(InData, Header);
+}
+
+bool FFileHelperCompression::Decompress(TConstArrayView<uint8> InData, TArray<uint8>& OutData)
+{
+	using namespace FileHelperCompression;
+
+	FHeader Header;
+	if (!ReadHeader(InData, Header))
+	{
+		return false;
+	}
+
+	const int32 BlockCount = Header.BlockSizes.Num();
+	TArray<int64> BlockOffsets;
+	BlockOffsets.SetNumUninitialized(BlockCount);
+	int64 Offset = Header.DataOffset;
+	for (int32 BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
+	{
+		BlockOffsets[BlockIndex] = Offset;
+		Offset += Header.BlockSizes[BlockIndex] & ~RawBlockFlag;
+	}
+
+	const FName Format = GetFormatName(Header.Codec);
+	OutData.SetNumUninitialized(static_cast<int32>(Header.UncompressedSize));
+	std::atomic<bool> bFailed{ false };
+	ParallelFor(BlockCount, [&](int32 BlockIndex)
+	{
+		const int32 OutOffset = BlockIndex * BlockSize;
+		const int32 RawSize = FMath::Min(BlockSize, OutData.Num() - OutOffset);
+		const uint32 StoredSize = Header.BlockSizes[BlockIndex];
+		const uint8* Source = InData.GetData() + BlockOffsets[BlockIndex];
+		if (StoredSize & RawBlockFlag)
+		{
+			if ((StoredSize & ~RawBlockFlag) != static_cast<uint32>(RawSize))
+			{
+				bFailed = true;
+				return;
+			}
+			FMemory::Memcpy(OutData.GetData() + OutOffset, Source, RawSize);
+		}
+		else if (!FCompression::UncompressMemory(Format, OutData.GetData() + OutOffset, RawSize, Source, static_cast<int32>(StoredSize)))
+		{
+			bFailed = true;
+		}
+	});
+
+	if (bFailed)
+	{
+		OutData.Reset();
+		return false;
+	}
+	return true;
+}
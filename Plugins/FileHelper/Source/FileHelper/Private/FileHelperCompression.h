@@ -0,0 +1,43 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FileHelperBPLibrary.h"
+
+/**
+ * Framed block compression on top of FCompression,
+ * data is split in fixed size blocks compressed and decompressed in parallel,
+ * a small header stores the codec and the block sizes, blocks that do not shrink are stored raw
+ */
+class FFileHelperCompression
+{
+public:
+	/** Size of the uncompressed blocks */
+	static constexpr int32 BlockSize = 256 * 1024;
+
+	/** Compresses data into a framed buffer */
+	static bool Compress(TConstArrayView<uint8> InData, EFileHelperCompressionCodec InCodec, TArray<uint8>& OutData);
+
+	/** Whether the buffer starts with a valid frame header */
+	static bool IsCompressed(TConstArrayView<uint8> InData);
+
+	/** Decompresses a framed buffer, fails when the frame is invalid or a block cannot be decompressed */
+	static bool Decompress(TConstArrayView<uint8> InData, TArray<uint8>& OutData);
+
+private:
+	struct FHeader
+	{
+		EFileHelperCompressionCodec Codec = EFileHelperCompressionCodec::Oodle;
+		int64 UncompressedSize = 0;
+		/** Stored size of each block, RawBlockFlag is set on blocks stored uncompressed */
+		TArray<uint32> BlockSizes;
+		/** Offset of the first block in the buffer */
+		int64 DataOffset = 0;
+	};
+
+	/** Reads and validates the header against the buffer size */
+	static bool ReadHeader(TConstArrayView<uint8> InData, FHeader& OutHeader);
+
+	static FName GetFormatName(EFileHelperCompressionCodec InCodec);
+};
@@ -0,0 +1,118 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperNative.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/Csv/CsvParser.h"
+
+#if !UE_BUILD_SHIPPING
+
+DEFINE_LOG_CATEGORY_STATIC(LogFileHelperBenchmark, Log, All);
+
+namespace FileHelperCsvBenchmark
+{
+	/** Former ReadCSV: whole file as FString, FCsvParser, then every cell copied */
+	bool ReadWithCsvParser(const FString& InPath, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal)
+	{
+		OutTotal = 0;
+		FString Content;
+		if (!FFileHelper::LoadFileToString(Content, *InPath))
+		{
+			return false;
+		}
+		const FCsvParser Parser(MoveTemp(Content));
+		for (const TArray<const TCHAR*>& Row : Parser.GetRows())
+		{
+			OutTotal++;
+			TArray<FString>& Target = OutTotal == 1 ? OutHeaders : OutData;
+			for (const TCHAR* Cell : Row)
+			{
+				Target.Emplace(Cell);
+			}
+		}
+		return true;
+	}
+
+	/** Cells compared case sensitively, FString equality ignores case */
+	bool IsSameData(const TArray<FString>& InA, const TArray<FString>& InB)
+	{
+		if (InA.Num() != InB.Num())
+		{
+			return false;
+		}
+		for (int32 Index = 0; Index < InA.Num(); ++Index)
+		{
+			if (!InA[Index].Equals(InB[Index], ESearchCase::CaseSensitive))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void Run(const TArray<FString>& InArgs)
+	{
+		if (InArgs.Num() < 1)
+		{
+			UE_LOG(LogFileHelperBenchmark, Warning, TEXT("Usage: FileHelper.BenchmarkCSV <Path> [Iterations]"));
+			return;
+		}
+		const FString& Path = InArgs[0];
+		const int32 Iterations = InArgs.Num() > 1 ? FMath::Max(FCString::Atoi(*InArgs[1]), 1) : 3;
+
+		struct FReader
+		{
+			const TCHAR* Name;
+			bool (*Read)(const FString&, TArray<FString>&, TArray<FString>&, int32&);
+		};
+		const FReader Readers[] =
+		{
+			{ TEXT("FCsvParser"), &ReadWithCsvParser },
+			{ TEXT("ReadCSV"), [](const FString& InPath, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal) { return FFileHelperNative::ReadCSV(InPath, OutHeaders, OutData, OutTotal); } },
+			{ TEXT("ReadCSVParallel"), [](const FString& InPath, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal) { return FFileHelperNative::ReadCSVParallel(InPath, OutHeaders, OutData, OutTotal); } }
+		};
+
+		bool bHasReference = false;
+		TArray<FString> ReferenceHeaders;
+		TArray<FString> ReferenceData;
+		int32 ReferenceTotal = 0;
+		for (const FReader& Reader : Readers)
+		{
+			double BestSeconds = TNumericLimits<double>::Max();
+			TArray<FString> Headers;
+			TArray<FString> Data;
+			int32 Total = 0;
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				Headers.Reset();
+				Data.Reset();
+				const double StartTime = FPlatformTime::Seconds();
+				if (!Reader.Read(Path, Headers, Data, Total))
+				{
+					UE_LOG(LogFileHelperBenchmark, Error, TEXT("%s failed to read %s"), Reader.Name, *Path);
+					return;
+				}
+				BestSeconds = FMath::Min(BestSeconds, FPlatformTime::Seconds() - StartTime);
+			}
+
+			// Every reader must give the rows of the reference parser
+			const bool bSameResult = !bHasReference || (Total == ReferenceTotal && IsSameData(Headers, ReferenceHeaders) && IsSameData(Data, ReferenceData));
+			if (!bHasReference)
+			{
+				bHasReference = true;
+				ReferenceHeaders = MoveTemp(Headers);
+				ReferenceData = MoveTemp(Data);
+				ReferenceTotal = Total;
+			}
+			UE_LOG(LogFileHelperBenchmark, Display, TEXT("%-16s %8.1f ms  %d rows%s"), Reader.Name, BestSeconds * 1000.0, Total, bSameResult ? TEXT("") : TEXT("  RESULT MISMATCH"));
+		}
+	}
+
+	static FAutoConsoleCommand BenchmarkCommand(
+		TEXT("FileHelper.BenchmarkCSV"),
+		TEXT("Times the FCsvParser, ReadCSV and ReadCSVParallel paths on a csv file, best of N runs. Usage: FileHelper.BenchmarkCSV <Path> [Iterations]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Run));
+}
+
+#endif
@@ -0,0 +1,267 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperCsvCache.h"
+
+#include "Async/MappedFileHandle.h"
+#include "FileHelperUtf8.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+namespace FileHelperCsvCache
+{
+	static constexpr uint32 Magic = 0x43484846; // FHHC
+	static constexpr uint32 Version = 1;
+
+	/**
+	 * Layout of the sidecar: header, end cell of each row, end byte of each cell in the text, text,
+	 * every section is 4 bytes aligned so the offsets are read in place from the mapped file
+	 */
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		int64 FileSize;
+		int64 ModificationTicks;
+		uint32 RowCount;
+		uint32 CellCount;
+		uint64 TextSize;
+	};
+	static_assert(sizeof(FHeader) == 40, "Sidecar header must stay packed");
+
+	/** Rows recorded while the source is parsed */
+	struct FRecorder
+	{
+		TArray<uint32> RowEnds;
+		TArray<uint32> CellEnds;
+		TArray<uint8> Text;
+
+		/** The text does not fit 32 bits offsets, nothing is saved */
+		bool bOverflow = false;
+
+		void Add(TConstArrayView<FUtf8StringView> InRow)
+		{
+			if (bOverflow)
+			{
+				return;
+			}
+			for (const FUtf8StringView& Cell : InRow)
+			{
+				if (static_cast<int64>(Text.Num()) + Cell.Len() > MAX_uint32 || CellEnds.Num() == MAX_int32)
+				{
+					bOverflow = true;
+					return;
+				}
+				Text.Append(reinterpret_cast<const uint8*>(Cell.GetData()), Cell.Len());
+				CellEnds.Add(Text.Num());
+			}
+			RowEnds.Add(CellEnds.Num());
+		}
+	};
+
+	bool GetSourceStat(const FString& InPath, int64& OutFileSize, FDateTime& OutModificationTime)
+	{
+		const FFileStatData Stat = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*InPath);
+		if (!Stat.bIsValid || Stat.bIsDirectory)
+		{
+			return false;
+		}
+		OutFileSize = Stat.FileSize;
+		OutModificationTime = Stat.ModificationTime;
+		return true;
+	}
+
+	/** Checks every offset of the sidecar before any row is visited so a truncated or foreign file is never read past its end */
+	bool IsUpToDate(TConstArrayView64<uint8> InBytes, int64 InFileSize, const FDateTime& InModificationTime)
+	{
+		if (InBytes.Num() < static_cast<int64>(sizeof(FHeader)))
+		{
+			return false;
+		}
+		const FHeader& Header = *reinterpret_cast<const FHeader*>(InBytes.GetData());
+		if (Header.Magic != Magic || Header.Version != Version || Header.FileSize != InFileSize || Header.ModificationTicks != InModificationTime.GetTicks())
+		{
+			return false;
+		}
+		const uint64 ExpectedSize = sizeof(FHeader) + (static_cast<uint64>(Header.RowCount) + Header.CellCount) * sizeof(uint32) + Header.TextSize;
+		if (ExpectedSize != static_cast<uint64>(InBytes.Num()))
+		{
+			return false;
+		}
+
+		const uint32* RowEnds = reinterpret_cast<const uint32*>(InBytes.GetData() + sizeof(FHeader));
+		const uint32* CellEnds = RowEnds + Header.RowCount;
+		uint32 Previous = 0;
+		for (uint32 Row = 0; Row < Header.RowCount; ++Row)
+		{
+			if (RowEnds[Row] < Previous || RowEnds[Row] > Header.CellCount)
+			{
+				return false;
+			}
+			Previous = RowEnds[Row];
+		}
+		if (Previous != Header.CellCount)
+		{
+			return false;
+		}
+		Previous = 0;
+		for (uint32 Cell = 0; Cell < Header.CellCount; ++Cell)
+		{
+			if (CellEnds[Cell] < Previous || CellEnds[Cell] > Header.TextSize)
+			{
+				return false;
+			}
+			Previous = CellEnds[Cell];
+		}
+		return true;
+	}
+
+	/** Visits the rows of a validated sidecar, cells point into the sidecar bytes */
+	void VisitRows(TConstArrayView64<uint8> InBytes, TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor)
+	{
+		const FHeader& Header = *reinterpret_cast<const FHeader*>(InBytes.GetData());
+		const uint32* RowEnds = reinterpret_cast<const uint32*>(InBytes.GetData() + sizeof(FHeader));
+		const uint32* CellEnds = RowEnds + Header.RowCount;
+		const UTF8CHAR* Text = reinterpret_cast<const UTF8CHAR*>(CellEnds + Header.CellCount);
+
+		TArray<FUtf8StringView> Cells;
+		uint32 Cell = 0;
+		uint32 CellStart = 0;
+		for (uint32 Row = 0; Row < Header.RowCount; ++Row)
+		{
+			Cells.Reset();
+			for (; Cell < RowEnds[Row]; ++Cell)
+			{
+				Cells.Emplace(Text + CellStart, static_cast<int32>(CellEnds[Cell] - CellStart));
+				CellStart = CellEnds[Cell];
+			}
+			if (!InRowVisitor(Cells))
+			{
+				return;
+			}
+		}
+	}
+
+	/** Maps the sidecar, or loads it when the platform cannot map files, then visits its rows when it matches the source */
+	bool ReadSidecar(const FString& InCachePath, int64 InFileSize, const FDateTime& InModificationTime, TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor)
+	{
+		IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+		if (!FileManager.FileExists(*InCachePath))
+		{
+			return false;
+		}
+
+		IPlatformFile::FOpenMappedResult Result = FileManager.OpenMappedEx(*InCachePath);
+		if (!Result.HasError())
+		{
+			TUniquePtr<IMappedFileHandle> Handle = Result.StealValue();
+			if (Handle.IsValid() && Handle->GetFileSize() > 0)
+			{
+				// Declared after the handle so it is released first
+				TUniquePtr<IMappedFileRegion> Region(Handle->MapRegion(0, Handle->GetFileSize()));
+				if (Region.IsValid())
+				{
+					const TConstArrayView64<uint8> Bytes(Region->GetMappedPtr(), Region->GetMappedSize());
+					if (!IsUpToDate(Bytes, InFileSize, InModificationTime))
+					{
+						return false;
+					}
+					VisitRows(Bytes, InRowVisitor);
+					return true;
+				}
+			}
+		}
+
+		TArray64<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *InCachePath) || !IsUpToDate(Bytes, InFileSize, InModificationTime))
+		{
+			return false;
+		}
+		VisitRows(Bytes, InRowVisitor);
+		return true;
+	}
+
+	/** Writes a temporary file then moves it over the sidecar so a mapped or concurrent reader never sees a partial file */
+	bool WriteSidecar(const FString& InCachePath, int64 InFileSize, const FDateTime& InModificationTime, const FRecorder& InRecorder)
+	{
+		const FString TempPath = InCachePath + TEXT(".tmp");
+		TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempPath));
+		if (!Writer.IsValid())
+		{
+			return false;
+		}
+
+		FHeader Header;
+		Header.Magic = Magic;
+		Header.Version = Version;
+		Header.FileSize = InFileSize;
+		Header.ModificationTicks = InModificationTime.GetTicks();
+		Header.RowCount = InRecorder.RowEnds.Num();
+		Header.CellCount = InRecorder.CellEnds.Num();
+		Header.TextSize = InRecorder.Text.Num();
+
+		Writer->Serialize(&Header, sizeof(FHeader));
+		Writer->Serialize(const_cast<uint32*>(InRecorder.RowEnds.GetData()), InRecorder.RowEnds.Num() * sizeof(uint32));
+		Writer->Serialize(const_cast<uint32*>(InRecorder.CellEnds.GetData()), InRecorder.CellEnds.Num() * sizeof(uint32));
+		Writer->Serialize(const_cast<uint8*>(InRecorder.Text.GetData()), InRecorder.Text.Num());
+		const bool bWritten = Writer->Close() && !Writer->IsError();
+		Writer.Reset();
+
+		if (!bWritten || !IFileManager::Get().Move(*InCachePath, *TempPath, true, true))
+		{
+			IFileManager::Get().Delete(*TempPath, false, true, true);
+			return false;
+		}
+		return true;
+	}
+}
+
+FString FFileHelperCsvCache::GetCachePath(const FString& InPath)
+{
+	return InPath + TEXT(".csvc");
+}
+
+bool FFileHelperCsvCache::ReadCSV(const FString& InPath, TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor)
+{
+	using namespace FileHelperCsvCache;
+
+	int64 FileSize = 0;
+	FDateTime ModificationTime;
+	if (!GetSourceStat(InPath, FileSize, ModificationTime))
+	{
+		return false;
+	}
+
+	const FString CachePath = GetCachePath(InPath);
+	if (ReadSidecar(CachePath, FileSize, ModificationTime, InRowVisitor))
+	{
+		return true;
+	}
+
+	// Missing or stale sidecar, rows are recorded while they are visited
+	FRecorder Recorder;
+	bool bComplete = true;
+	const bool bResult = FFileHelperUtf8::StreamCSV(InPath, [&Recorder, &bComplete, &InRowVisitor](TConstArrayView<FUtf8StringView> Row)->bool
+	{
+		Recorder.Add(Row);
+		bComplete = InRowVisitor(Row);
+		return bComplete;
+	});
+
+	// The sidecar is skipped when the source changed while it was parsed, the source may also be in a read only directory
+	int64 ParsedFileSize = 0;
+	FDateTime ParsedModificationTime;
+	if (bResult && bComplete && !Recorder.bOverflow
+		&& GetSourceStat(InPath, ParsedFileSize, ParsedModificationTime) && ParsedFileSize == FileSize && ParsedModificationTime == ModificationTime)
+	{
+		WriteSidecar(CachePath, FileSize, ModificationTime, Recorder);
+	}
+	return bResult;
+}
+
+bool FFileHelperCsvCache::Remove(const FString& InPath)
+{
+	const FString CachePath = GetCachePath(InPath);
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	return !FileManager.FileExists(*CachePath) || FileManager.DeleteFile(*CachePath);
+}
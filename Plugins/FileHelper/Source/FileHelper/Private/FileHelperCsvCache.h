@@ -0,0 +1,26 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Parsed rows of a csv file stored in a sidecar file next to the source (<file>.csvc),
+ * the sidecar is memory mapped and its cells are visited in place without tokenizing again,
+ * it is only used while the size and modification time of the source file match and is rebuilt otherwise
+ */
+class FFileHelperCsvCache
+{
+public:
+	/**
+	 * Visits the rows of a csv file from its sidecar when it is up to date, parses the file and writes the sidecar otherwise,
+	 * rows are the same as FFileHelperUtf8::StreamCSV, cell views are only valid during the visitor call
+	 */
+	static bool ReadCSV(const FString& InPath, TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor);
+
+	/** Removes the sidecar of a file */
+	static bool Remove(const FString& InPath);
+
+	/** Path of the sidecar cache file */
+	static FString GetCachePath(const FString& InPath);
+};
@@ -0,0 +1,142 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperCsvStreamAction.h"
+
+#include "Async/Async.h"
+#include "FileHelperUtf8.h"
+
+namespace FileHelperCsvStreamAction
+{
+	/** Batches sent to the game thread and not delivered yet before the worker waits */
+	static constexpr int32 MaxPendingBatches = 4;
+}
+
+UFileHelperReadCSVStreamAction* UFileHelperReadCSVStreamAction::ReadCSVStreamAsync(const FString& Path, int32 BatchSize, bool HeaderFirst)
+{
+	UFileHelperReadCSVStreamAction* Node = NewObject<UFileHelperReadCSVStreamAction>();
+	Node->Path = Path;
+	Node->BatchSize = FMath::Max(BatchSize, 1);
+	Node->bHeaderFirst = HeaderFirst;
+	Node->bActive = false;
+	return Node;
+}
+
+void UFileHelperReadCSVStreamAction::Cancel()
+{
+	if (State.IsValid())
+	{
+		State->Cancel();
+	}
+}
+
+void UFileHelperReadCSVStreamAction::Activate()
+{
+	using namespace FileHelperCsvStreamAction;
+
+	if (bActive)
+	{
+		FFrame::KismetExecutionMessage(TEXT("ReadCSVStreamAction is already running"), ELogVerbosity::Warning);
+		Failed.Broadcast(TArray<FString>(), TArray<FString>(), 0);
+		return;
+	}
+
+	bActive = true;
+	State = MakeShared<FStreamState, ESPMode::ThreadSafe>();
+
+	TWeakObjectPtr<UFileHelperReadCSVStreamAction> ThisWeak(this);
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [ThisWeak, InState = State.ToSharedRef(), InPath = MoveTemp(Path), InBatchSize = BatchSize, bInHeaderFirst = bHeaderFirst]()
+	{
+		TArray<FString> Headers;
+		TArray<FString> Data;
+		int32 Total = 0;
+		int32 BatchRows = 0;
+
+		auto SendBatch = [&]()
+		{
+			// Keeps memory bounded when the game thread is slower than the parsing
+			while (InState->PendingBatches >= MaxPendingBatches && !InState->bCancelled)
+			{
+				InState->BatchDelivered->Wait();
+			}
+			++InState->PendingBatches;
+			AsyncTask(ENamedThreads::Type::GameThread, [ThisWeak, InState, Headers, Data = MoveTemp(Data), Total]()
+			{
+				UFileHelperReadCSVStreamAction* This = ThisWeak.Get();
+				if (!This)
+				{
+					InState->bCancelled = true;
+				}
+				else if (This->bActive && !InState->bCancelled)
+				{
+					This->OnBatchRead(Headers, Data, Total);
+				}
+				--InState->PendingBatches;
+				InState->BatchDelivered->Trigger();
+			});
+			Data.Reset();
+			BatchRows = 0;
+		};
+
+		const bool bResult = FFileHelperUtf8::StreamCSV(InPath, [&](TConstArrayView<FUtf8StringView> Row)->bool
+		{
+			if (InState->bCancelled)
+			{
+				return false;
+			}
+			Total++;
+			const bool bHeader = Total == 1 && bInHeaderFirst;
+			TArray<FString>& Target = bHeader ? Headers : Data;
+			for (const FUtf8StringView& Cell : Row)
+			{
+				Target.Emplace(Cell.Len(), Cell.GetData());
+			}
+			if (!bHeader && ++BatchRows >= InBatchSize)
+			{
+				SendBatch();
+			}
+			return true;
+		});
+
+		if (bResult && BatchRows > 0 && !InState->bCancelled)
+		{
+			SendBatch();
+		}
+
+		// Queued after the batches so Completed is called last
+		AsyncTask(ENamedThreads::Type::GameThread, [ThisWeak, bResult = bResult && !InState->bCancelled, Headers = MoveTemp(Headers), Total]() mutable
+		{
+			if (UFileHelperReadCSVStreamAction* This = ThisWeak.Get())
+			{
+				This->OnTaskCompleted(bResult, MoveTemp(Headers), Total);
+			}
+		});
+	});
+}
+
+void UFileHelperReadCSVStreamAction::OnBatchRead(const TArray<FString>& InHeaders, const TArray<FString>& InData, int32 InTotal)
+{
+	Rows.Broadcast(InHeaders, InData, InTotal);
+}
+
+void UFileHelperReadCSVStreamAction::OnTaskCompleted(bool bInSuccess, TArray<FString>&& InHeaders, int32 InTotal)
+{
+	// A cancel from the last batch handler is only seen here
+	const bool bCancelled = State.IsValid() && State->bCancelled;
+	Reset();
+
+	if (bInSuccess && !bCancelled)
+	{
+		Completed.Broadcast(InHeaders, TArray<FString>(), InTotal);
+	}
+	else
+	{
+		Failed.Broadcast(InHeaders, TArray<FString>(), InTotal);
+	}
+}
+
+void UFileHelperReadCSVStreamAction::Reset()
+{
+	bActive = false;
+	State.Reset();
+	Path.Empty();
+}
@@ -0,0 +1,419 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperCsvTable.h"
+
+#include "Containers/Utf8String.h"
+#include "FileHelperCsvValue.h"
+#include "FileHelperUtf8.h"
+#include "Hash/xxhash.h"
+
+namespace FileHelperCsvTable
+{
+	/** What a cell can be read as, numbers are both Int and Double when they fit in an int64 */
+	enum ECellKind : uint8
+	{
+		Empty = 1 << 0,
+		Int = 1 << 1,
+		Double = 1 << 2,
+		Bool = 1 << 3,
+		True = 1 << 4
+	};
+
+	/** Integer part starting with a zero followed by digits (01234, -007.5), kept as text so it is written back unchanged */
+	bool HasLeadingZero(FUtf8StringView InText)
+	{
+		int32 Index = 0;
+		if (Index < InText.Len() && (InText[Index] == '+' || InText[Index] == '-'))
+		{
+			++Index;
+		}
+		return Index + 1 < InText.Len() && InText[Index] == '0' && InText[Index + 1] >= '0' && InText[Index + 1] <= '9';
+	}
+
+	uint8 ClassifyCell(FUtf8StringView InText)
+	{
+		if (InText.IsEmpty())
+		{
+			return Empty;
+		}
+		if (InText.Equals(UTF8TEXT("true"), ESearchCase::IgnoreCase))
+		{
+			return Bool | True;
+		}
+		if (InText.Equals(UTF8TEXT("false"), ESearchCase::IgnoreCase))
+		{
+			return Bool;
+		}
+		if (HasLeadingZero(InText))
+		{
+			return 0;
+		}
+
+		uint8 Kind = 0;
+		int64 Value = 0;
+		if (FileHelperCsvValue::ParseInt(InText, Value))
+		{
+			Kind |= Int;
+		}
+		if (FileHelperCsvValue::IsNumber(InText))
+		{
+			Kind |= Double;
+		}
+		return Kind;
+	}
+
+	/** Unique text of the string columns, entries are chained by hash so repeated cells are not allocated again */
+	class FTextPool
+	{
+	public:
+		int32 Intern(FUtf8StringView InText)
+		{
+			const uint64 Hash = FXxHash64::HashBuffer(InText.GetData(), InText.Len()).Hash;
+			const int32* Head = Heads.Find(Hash);
+			const int32 FirstIndex = Head ? *Head : INDEX_NONE;
+			for (int32 Index = FirstIndex; Index != INDEX_NONE; Index = Next[Index])
+			{
+				if (FUtf8StringView(Texts[Index]).Equals(InText, ESearchCase::CaseSensitive))
+				{
+					return Index;
+				}
+			}
+
+			const int32 Index = Texts.Emplace(InText);
+			Next.Add(FirstIndex);
+			Heads.Add(Hash, Index);
+			return Index;
+		}
+
+		TArray<FUtf8String> Texts;
+
+	private:
+		TMap<uint64, int32> Heads;
+		TArray<int32> Next;
+	};
+}
+
+UFileHelperCSVTable* UFileHelperCSVTable::ReadCSVTable(const FString& Path, bool HeaderFirst)
+{
+	UFileHelperCSVTable* Table = NewObject<UFileHelperCSVTable>();
+	const bool bResult = Table->Build([&Path](TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor)->bool{
+		return FFileHelperUtf8::StreamCSV(Path, InRowVisitor);
+	}, HeaderFirst);
+	return bResult ? Table : nullptr;
+}
+
+UFileHelperCSVTable* UFileHelperCSVTable::StringToCSVTable(const FString& Content, bool HeaderFirst)
+{
+	UFileHelperCSVTable* Table = NewObject<UFileHelperCSVTable>();
+	Table->Build([&Content](TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor)->bool{
+		FFileHelperUtf8::ParseCSV(Content, InRowVisitor);
+		return true;
+	}, HeaderFirst);
+	return Table;
+}
+
+bool UFileHelperCSVTable::Build(TFunctionRef<bool(TFunctionRef<bool(TConstArrayView<FUtf8StringView>)>)> InReadRows, bool bInHeaderFirst)
+{
+	using namespace FileHelperCsvTable;
+
+	Columns.Reset();
+	StringPool.Reset();
+	RowCount = 0;
+
+	auto Fail = [this]()
+	{
+		Columns.Reset();
+		StringPool.Reset();
+		RowCount = 0;
+		return false;
+	};
+
+	// First pass only finds the narrowest type every non empty cell of a column fits in, nothing is stored
+	TArray<uint8> ColumnKinds;
+	TArray<bool> ColumnHasValue;
+	bool bFirstRow = true;
+	bool bResult = InReadRows([&](TConstArrayView<FUtf8StringView> Row)->bool{
+		if (bFirstRow)
+		{
+			bFirstRow = false;
+			Columns.SetNum(Row.Num());
+			ColumnKinds.Init(Int | Double | Bool, Row.Num());
+			ColumnHasValue.Init(false, Row.Num());
+			for (int32 Column = 0; Column < Row.Num(); ++Column)
+			{
+				Columns[Column].Name = bInHeaderFirst ? FString(Row[Column].Len(), Row[Column].GetData()) : FString::FromInt(Column);
+			}
+			if (bInHeaderFirst)
+			{
+				return true;
+			}
+		}
+		for (int32 Column = 0; Column < Columns.Num() && Column < Row.Num(); ++Column)
+		{
+			const uint8 Kind = ClassifyCell(Row[Column]);
+			if (!(Kind & Empty))
+			{
+				ColumnHasValue[Column] = true;
+				ColumnKinds[Column] &= Kind;
+			}
+		}
+		RowCount++;
+		return true;
+	});
+	if (!bResult)
+	{
+		return Fail();
+	}
+
+	for (int32 Column = 0; Column < Columns.Num(); ++Column)
+	{
+		FColumn& Target = Columns[Column];
+		const uint8 ColumnKind = ColumnKinds[Column];
+		if (!ColumnHasValue[Column])
+		{
+			Target.Type = EFileHelperCSVColumnType::String;
+		}
+		else if (ColumnKind & Int)
+		{
+			Target.Type = EFileHelperCSVColumnType::Int;
+			Target.Ints.Reserve(RowCount);
+		}
+		else if (ColumnKind & Double)
+		{
+			Target.Type = EFileHelperCSVColumnType::Double;
+			Target.Doubles.Reserve(RowCount);
+		}
+		else if (ColumnKind & Bool)
+		{
+			Target.Type = EFileHelperCSVColumnType::Bool;
+			Target.Bools.Reserve(RowCount);
+		}
+		else
+		{
+			Target.Type = EFileHelperCSVColumnType::String;
+		}
+		if (Target.Type == EFileHelperCSVColumnType::String)
+		{
+			Target.Strings.Reserve(RowCount);
+		}
+	}
+
+	// Second pass stores typed cells directly, only text of string columns is pooled
+	FTextPool Pool;
+	int32 FilledRows = 0;
+	bFirstRow = bInHeaderFirst;
+	bResult = InReadRows([&](TConstArrayView<FUtf8StringView> Row)->bool{
+		if (bFirstRow)
+		{
+			bFirstRow = false;
+			return true;
+		}
+		if (FilledRows == RowCount)
+		{
+			// The source got more rows since the first pass
+			return false;
+		}
+		for (int32 Column = 0; Column < Columns.Num(); ++Column)
+		{
+			FColumn& Target = Columns[Column];
+			const FUtf8StringView Cell = Column < Row.Num() ? Row[Column] : FUtf8StringView();
+			switch (Target.Type)
+			{
+			case EFileHelperCSVColumnType::Int:
+			{
+				int64 Value = 0;
+				FileHelperCsvValue::ParseInt(Cell, Value);
+				Target.Ints.Add(Value);
+				break;
+			}
+			case EFileHelperCSVColumnType::Double:
+			{
+				double Value = 0.0;
+				FileHelperCsvValue::ParseNumber(Cell, Value);
+				Target.Doubles.Add(Value);
+				break;
+			}
+			case EFileHelperCSVColumnType::Bool:
+				Target.Bools.Add(Cell.Equals(UTF8TEXT("true"), ESearchCase::IgnoreCase));
+				break;
+			case EFileHelperCSVColumnType::String:
+				Target.Strings.Add(Pool.Intern(Cell));
+				break;
+			}
+		}
+		FilledRows++;
+		return true;
+	});
+	if (!bResult || FilledRows != RowCount)
+	{
+		return Fail();
+	}
+
+	StringPool.Reserve(Pool.Texts.Num());
+	for (const FUtf8String& Text : Pool.Texts)
+	{
+		StringPool.Emplace(Text.Len(), *Text);
+	}
+	return true;
+}
+
+TArray<FString> UFileHelperCSVTable::GetColumnNames() const
+{
+	TArray<FString> Names;
+	Names.Reserve(Columns.Num());
+	for (const FColumn& Column : Columns)
+	{
+		Names.Add(Column.Name);
+	}
+	return Names;
+}
+
+int32 UFileHelperCSVTable::FindColumn(const FString& Name) const
+{
+	return Columns.IndexOfByPredicate([&Name](const FColumn& Column)
+	{
+		return Column.Name.Equals(Name, ESearchCase::CaseSensitive);
+	});
+}
+
+EFileHelperCSVColumnType UFileHelperCSVTable::GetColumnType(int32 Column) const
+{
+	const FColumn* Target = GetColumn(Column);
+	return Target ? Target->Type : EFileHelperCSVColumnType::String;
+}
+
+int64 UFileHelperCSVTable::GetInt(int32 Column, int32 Row) const
+{
+	const FColumn* Target = GetCellColumn(Column, Row);
+	if (!Target)
+	{
+		return 0;
+	}
+	switch (Target->Type)
+	{
+	case EFileHelperCSVColumnType::Int:
+		return Target->Ints[Row];
+	case EFileHelperCSVColumnType::Double:
+		return static_cast<int64>(Target->Doubles[Row]);
+	default:
+		return 0;
+	}
+}
+
+double UFileHelperCSVTable::GetDouble(int32 Column, int32 Row) const
+{
+	const FColumn* Target = GetCellColumn(Column, Row);
+	if (!Target)
+	{
+		return 0.0;
+	}
+	switch (Target->Type)
+	{
+	case EFileHelperCSVColumnType::Int:
+		return static_cast<double>(Target->Ints[Row]);
+	case EFileHelperCSVColumnType::Double:
+		return Target->Doubles[Row];
+	default:
+		return 0.0;
+	}
+}
+
+bool UFileHelperCSVTable::GetBool(int32 Column, int32 Row) const
+{
+	const FColumn* Target = GetCellColumn(Column, Row);
+	return Target && Target->Type == EFileHelperCSVColumnType::Bool && Target->Bools[Row];
+}
+
+FString UFileHelperCSVTable::GetString(int32 Column, int32 Row) const
+{
+	const FColumn* Target = GetCellColumn(Column, Row);
+	if (!Target)
+	{
+		return FString();
+	}
+	switch (Target->Type)
+	{
+	case EFileHelperCSVColumnType::Int:
+		return LexToString(Target->Ints[Row]);
+	case EFileHelperCSVColumnType::Double:
+		return FString::SanitizeFloat(Target->Doubles[Row]);
+	case EFileHelperCSVColumnType::Bool:
+		return Target->Bools[Row] ? TEXT("true") : TEXT("false");
+	default:
+		return StringPool[Target->Strings[Row]];
+	}
+}
+
+TArray<int64> UFileHelperCSVTable::GetIntColumn(int32 Column) const
+{
+	return TArray<int64>(GetIntValues(Column));
+}
+
+TArray<double> UFileHelperCSVTable::GetDoubleColumn(int32 Column) const
+{
+	const FColumn* Target = GetColumn(Column);
+	if (Target && Target->Type == EFileHelperCSVColumnType::Int)
+	{
+		TArray<double> Values;
+		Values.Reserve(Target->Ints.Num());
+		for (const int64 Value : Target->Ints)
+		{
+			Values.Add(static_cast<double>(Value));
+		}
+		return Values;
+	}
+	return TArray<double>(GetDoubleValues(Column));
+}
+
+TArray<bool> UFileHelperCSVTable::GetBoolColumn(int32 Column) const
+{
+	return TArray<bool>(GetBoolValues(Column));
+}
+
+TArray<FString> UFileHelperCSVTable::GetStringColumn(int32 Column) const
+{
+	TArray<FString> Values;
+	if (GetColumn(Column))
+	{
+		Values.Reserve(RowCount);
+		for (int32 Row = 0; Row < RowCount; ++Row)
+		{
+			Values.Add(GetString(Column, Row));
+		}
+	}
+	return Values;
+}
+
+TConstArrayView<int64> UFileHelperCSVTable::GetIntValues(int32 InColumn) const
+{
+	const FColumn* Target = GetColumn(InColumn);
+	return Target ? TConstArrayView<int64>(Target->Ints) : TConstArrayView<int64>();
+}
+
+TConstArrayView<double> UFileHelperCSVTable::GetDoubleValues(int32 InColumn) const
+{
+	const FColumn* Target = GetColumn(InColumn);
+	return Target ? TConstArrayView<double>(Target->Doubles) : TConstArrayView<double>();
+}
+
+TConstArrayView<bool> UFileHelperCSVTable::GetBoolValues(int32 InColumn) const
+{
+	const FColumn* Target = GetColumn(InColumn);
+	return Target ? TConstArrayView<bool>(Target->Bools) : TConstArrayView<bool>();
+}
+
+TConstArrayView<int32> UFileHelperCSVTable::GetStringIndexes(int32 InColumn) const
+{
+	const FColumn* Target = GetColumn(InColumn);
+	return Target ? TConstArrayView<int32>(Target->Strings) : TConstArrayView<int32>();
+}
+
+const UFileHelperCSVTable::FColumn* UFileHelperCSVTable::GetColumn(int32 InColumn) const
+{
+	return Columns.IsValidIndex(InColumn) ? &Columns[InColumn] : nullptr;
+}
+
+const UFileHelperCSVTable::FColumn* UFileHelperCSVTable::GetCellColumn(int32 InColumn, int32 InRow) const
+{
+	return (InRow >= 0 && InRow < RowCount) ? GetColumn(InColumn) : nullptr;
+}
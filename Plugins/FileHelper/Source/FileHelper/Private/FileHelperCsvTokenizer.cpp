@@ -0,0 +1,294 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperCsvTokenizer.h"
+
+#include "Async/ParallelFor.h"
+#include "FileHelperSIMD.h"
+
+namespace FileHelperCsvTokenizer
+{
+	/** Bytes covered by one structural mask */
+	static constexpr int64 BlockSize = 64;
+
+	/** Same ASCII set as FChar::IsWhitespace, used by FCsvParser to find the opening quote of a cell */
+	FORCEINLINE bool IsWhitespace(uint8 InChar)
+	{
+		return InChar == ' ' || (InChar >= '\t' && InChar <= '\r');
+	}
+
+	FORCEINLINE bool IsStructural(uint8 InChar)
+	{
+		return InChar == ',' || InChar == '"' || InChar == '\r' || InChar == '\n';
+	}
+
+	FORCEINLINE FUtf8StringView MakeView(const uint8* InStart, const uint8* InEnd)
+	{
+		return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(InStart), static_cast<int32>(InEnd - InStart));
+	}
+}
+
+const uint8* FFileHelperCsvTokenizer::FStructuralScanner::FindNext(const uint8* InFrom)
+{
+	using namespace FileHelperCsvTokenizer;
+
+	while (InFrom < End)
+	{
+		if (Block == nullptr || InFrom < Block || InFrom >= Block + BlockSize)
+		{
+			Block = InFrom;
+			if (End - Block >= BlockSize)
+			{
+				Mask = FileHelperSIMD::FindAnyOf4Mask64(Block, ',', '"', '\r', '\n');
+			}
+			else
+			{
+				// Tail shorter than a block
+				Mask = 0;
+				for (int64 Index = 0; Index < End - Block; ++Index)
+				{
+					if (IsStructural(Block[Index]))
+					{
+						Mask |= uint64(1) << Index;
+					}
+				}
+			}
+		}
+
+		const uint64 Remaining = Mask & (~uint64(0) << (InFrom - Block));
+		if (Remaining != 0)
+		{
+			return Block + FMath::CountTrailingZeros64(Remaining);
+		}
+		InFrom = Block + BlockSize;
+	}
+	return End;
+}
+
+const uint8* FFileHelperCsvTokenizer::FindRowsEnd(const uint8* InStart, const uint8* InEnd, bool bInLastChunk)
+{
+	using namespace FileHelperCsvTokenizer;
+
+	if (bInLastChunk)
+	{
+		return InEnd;
+	}
+
+	FStructuralScanner RowScanner(InEnd);
+	const uint8* RowsEnd = InStart;
+	const uint8* ReadAt = InStart;
+	while (ReadAt < InEnd)
+	{
+		// Cell start, whitespaces (new lines included) before a quote are skipped like in ParseCell
+		const uint8* QuoteTest = ReadAt;
+		while (QuoteTest < InEnd && IsWhitespace(*QuoteTest))
+		{
+			++QuoteTest;
+		}
+		if (QuoteTest >= InEnd)
+		{
+			// Unknown yet whether a quoted cell follows
+			break;
+		}
+		bool bQuoted = *QuoteTest == '"';
+		if (bQuoted)
+		{
+			ReadAt = QuoteTest + 1;
+		}
+
+		while ((ReadAt = RowScanner.FindNext(ReadAt)) < InEnd)
+		{
+			if (bQuoted)
+			{
+				if (*ReadAt == '"')
+				{
+					if (ReadAt + 1 >= InEnd)
+					{
+						// Closing or escaped quote depends on the next chunk
+						return RowsEnd;
+					}
+					if (*(ReadAt + 1) == '"')
+					{
+						ReadAt += 2;
+						continue;
+					}
+					bQuoted = false;
+				}
+				++ReadAt;
+				continue;
+			}
+
+			if (*ReadAt == '\r' || *ReadAt == '\n')
+			{
+				// A \n left for the next chunk is skipped there as an empty line
+				ReadAt += (*ReadAt == '\r' && ReadAt + 1 < InEnd && *(ReadAt + 1) == '\n') ? 2 : 1;
+				RowsEnd = ReadAt;
+				break;
+			}
+			if (*(ReadAt++) == ',')
+			{
+				break;
+			}
+		}
+	}
+	return RowsEnd;
+}
+
+void FFileHelperCsvTokenizer::SplitRows(const uint8* InStart, const uint8* InEnd, int32 InChunkCount, TArray<const uint8*>& OutBoundaries)
+{
+	OutBoundaries.Reset();
+	OutBoundaries.Add(InStart);
+
+	// Candidate cuts right after the first line break past each even offset
+	const int64 Size = InEnd - InStart;
+	const int32 ChunkCount = static_cast<int32>(FMath::Clamp<int64>(InChunkCount, 1, FMath::Max<int64>(Size, 1)));
+	for (int32 Chunk = 1; Chunk < ChunkCount; ++Chunk)
+	{
+		const uint8* Target = FMath::Max(InStart + Size * Chunk / ChunkCount, OutBoundaries.Last());
+		const uint8* LineBreak = FileHelperSIMD::FindLineBreak(Target, InEnd);
+		if (LineBreak >= InEnd)
+		{
+			break;
+		}
+		const uint8* Cut = LineBreak + ((*LineBreak == '\r' && LineBreak + 1 < InEnd && *(LineBreak + 1) == '\n') ? 2 : 1);
+		if (Cut < InEnd && Cut > OutBoundaries.Last())
+		{
+			OutBoundaries.Add(Cut);
+		}
+	}
+	OutBoundaries.Add(InEnd);
+
+	// A range starting on a row makes the next cut valid when its complete rows end exactly there
+	TArray<bool> ValidCuts;
+	ValidCuts.SetNumZeroed(OutBoundaries.Num() - 1);
+	ParallelFor(ValidCuts.Num() - 1, [&](int32 Range)
+	{
+		ValidCuts[Range + 1] = FindRowsEnd(OutBoundaries[Range], OutBoundaries[Range + 1], false) == OutBoundaries[Range + 1];
+	});
+
+	// The first range starts on a row, invalid cuts are merged into the previous range and checked again from its start
+	TArray<const uint8*> Boundaries;
+	Boundaries.Reserve(OutBoundaries.Num());
+	Boundaries.Add(InStart);
+	for (int32 Cut = 1; Cut < OutBoundaries.Num() - 1; ++Cut)
+	{
+		const bool bMerged = Boundaries.Last() != OutBoundaries[Cut - 1];
+		if (bMerged ? FindRowsEnd(Boundaries.Last(), OutBoundaries[Cut], false) == OutBoundaries[Cut] : ValidCuts[Cut])
+		{
+			Boundaries.Add(OutBoundaries[Cut]);
+		}
+	}
+	Boundaries.Add(InEnd);
+	OutBoundaries = MoveTemp(Boundaries);
+}
+
+bool FFileHelperCsvTokenizer::ParseRow(TArray<FUtf8StringView>& OutCells)
+{
+	OutCells.Reset();
+	if (bDone)
+	{
+		return false;
+	}
+
+	// Empty lines do not produce rows
+	while (const int32 NewLineSize = MeasureNewLine(Cursor))
+	{
+		Cursor += NewLineSize;
+		if (Cursor >= End)
+		{
+			bDone = true;
+			return false;
+		}
+	}
+
+	EParseResult Result;
+	do
+	{
+		FUtf8StringView Cell;
+		Result = ParseCell(Cell);
+		OutCells.Add(Cell);
+	}
+	while (Result == EParseResult::EndOfCell);
+
+	bDone = Result == EParseResult::EndOfString;
+	return true;
+}
+
+FFileHelperCsvTokenizer::EParseResult FFileHelperCsvTokenizer::ParseCell(FUtf8StringView& OutCell)
+{
+	using namespace FileHelperCsvTokenizer;
+
+	uint8* const CellStart = Cursor;
+	uint8* WriteAt = Cursor;
+	uint8* ReadAt = Cursor;
+
+	// Whitespace between cell opening and quote is ignored
+	const uint8* QuoteTest = ReadAt;
+	while (QuoteTest < End && IsWhitespace(*QuoteTest))
+	{
+		++QuoteTest;
+	}
+	bool bQuoted = QuoteTest < End && *QuoteTest == '"';
+	if (bQuoted)
+	{
+		ReadAt = const_cast<uint8*>(QuoteTest) + 1;
+	}
+
+	while (true)
+	{
+		// Bytes up to the next structural byte are kept as is, they only move once something was unescaped
+		uint8* const Next = const_cast<uint8*>(Scanner.FindNext(ReadAt));
+		if (WriteAt != ReadAt)
+		{
+			FMemory::Memmove(WriteAt, ReadAt, Next - ReadAt);
+		}
+		WriteAt += Next - ReadAt;
+		ReadAt = Next;
+
+		if (ReadAt >= End)
+		{
+			break;
+		}
+
+		if (bQuoted)
+		{
+			if (*ReadAt == '"')
+			{
+				// RFC 4180 specifies that double quotes are escaped as ""
+				if (ReadAt + 1 < End && *(ReadAt + 1) == '"')
+				{
+					*(WriteAt++) = '"';
+					ReadAt += 2;
+					continue;
+				}
+
+				// Unescaped quote ends the quoted part, the rest is read until the next delimiter
+				bQuoted = false;
+				++ReadAt;
+				continue;
+			}
+		}
+		else
+		{
+			const int32 NewLineSize = MeasureNewLine(ReadAt);
+			if (NewLineSize != 0)
+			{
+				OutCell = MakeView(CellStart, WriteAt);
+				Cursor = ReadAt + NewLineSize;
+				return Cursor < End ? EParseResult::EndOfRow : EParseResult::EndOfString;
+			}
+			if (*ReadAt == ',')
+			{
+				OutCell = MakeView(CellStart, WriteAt);
+				Cursor = ReadAt + 1;
+				return EParseResult::EndOfCell;
+			}
+		}
+
+		// Delimiters and new lines in a quoted cell, quotes after the quoted part
+		*(WriteAt++) = *(ReadAt++);
+	}
+
+	OutCell = MakeView(CellStart, WriteAt);
+	Cursor = End;
+	return EParseResult::EndOfString;
+}
@@ -0,0 +1,91 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Tokenizes UTF-8 csv text with the same rules as FCsvParser:
+ * cells are separated by commas and rows by \r\n, \n or \r, empty lines are skipped,
+ * a cell starting with a quote (after whitespaces) is quoted, it can contain delimiters and new lines and "" is unescaped to ",
+ * quoted cells are unescaped in place, so the buffer is modified and cells are views into it,
+ * delimiters, quotes and new lines are located with a bitmask of 64 bytes so the text between them is skipped at once
+ */
+class FFileHelperCsvTokenizer
+{
+public:
+	FFileHelperCsvTokenizer(uint8* InStart, uint8* InEnd)
+		: Cursor(InStart)
+		, End(InEnd)
+		, Scanner(InEnd)
+	{}
+
+	/** Parses the next row, cells are valid as long as the buffer is, returns false when there is no row left */
+	bool ParseRow(TArray<FUtf8StringView>& OutCells);
+
+	/**
+	 * Finds the end of the last row that is complete in a chunk starting at a row boundary,
+	 * quoted cells can span new lines so rows are followed with the same rules as ParseRow,
+	 * the chunk is returned whole when it is the last one, the chunk start is returned when no row is complete yet
+	 */
+	static const uint8* FindRowsEnd(const uint8* InStart, const uint8* InEnd, bool bInLastChunk);
+
+	/**
+	 * Splits csv text into about InChunkCount ranges of whole rows, so each range can be tokenized on its own,
+	 * ranges are cut after a line break near even offsets and every cut is checked in parallel with FindRowsEnd,
+	 * a cut falling in a quoted cell is removed, OutBoundaries holds the range starts followed by the text end
+	 */
+	static void SplitRows(const uint8* InStart, const uint8* InEnd, int32 InChunkCount, TArray<const uint8*>& OutBoundaries);
+
+	/** Current read position in the buffer */
+	const uint8* GetCursor() const
+	{
+		return Cursor;
+	}
+
+private:
+	enum class EParseResult : uint8
+	{
+		EndOfCell,
+		EndOfRow,
+		EndOfString
+	};
+
+	/** Finds the next comma, quote or new line, the mask of the current 64 bytes block is kept between calls */
+	class FStructuralScanner
+	{
+	public:
+		explicit FStructuralScanner(const uint8* InEnd)
+			: End(InEnd)
+		{}
+
+		/** Returns the first structural byte at or after InFrom, End when there is none */
+		const uint8* FindNext(const uint8* InFrom);
+
+	private:
+		const uint8* End = nullptr;
+		const uint8* Block = nullptr;
+		uint64 Mask = 0;
+	};
+
+	EParseResult ParseCell(FUtf8StringView& OutCell);
+
+	/** Size of the new line sequence at a position, 0 when there is none */
+	int32 MeasureNewLine(const uint8* InAt) const
+	{
+		if (InAt >= End)
+		{
+			return 0;
+		}
+		if (*InAt == '\r')
+		{
+			return (InAt + 1 < End && *(InAt + 1) == '\n') ? 2 : 1;
+		}
+		return *InAt == '\n' ? 1 : 0;
+	}
+
+	uint8* Cursor = nullptr;
+	uint8* End = nullptr;
+	FStructuralScanner Scanner;
+	bool bDone = false;
+};
@@ -0,0 +1,101 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperCsvValue.h"
+
+namespace FileHelperCsvValue
+{
+	FORCEINLINE bool IsDigit(UTF8CHAR InChar)
+	{
+		return InChar >= '0' && InChar <= '9';
+	}
+
+	bool ParseInt(FUtf8StringView InText, int64& OutValue)
+	{
+		const UTF8CHAR* It = InText.GetData();
+		const UTF8CHAR* End = It + InText.Len();
+		bool bNegative = false;
+		if (It < End && (*It == '+' || *It == '-'))
+		{
+			bNegative = *It == '-';
+			++It;
+		}
+		if (It == End)
+		{
+			return false;
+		}
+
+		const uint64 Limit = bNegative ? static_cast<uint64>(MAX_int64) + 1 : static_cast<uint64>(MAX_int64);
+		uint64 Value = 0;
+		for (; It < End; ++It)
+		{
+			if (!IsDigit(*It))
+			{
+				return false;
+			}
+			const uint64 Digit = *It - '0';
+			if (Value > (Limit - Digit) / 10)
+			{
+				return false;
+			}
+			Value = Value * 10 + Digit;
+		}
+		OutValue = bNegative ? static_cast<int64>(0 - Value) : static_cast<int64>(Value);
+		return true;
+	}
+
+	bool IsNumber(FUtf8StringView InText)
+	{
+		const UTF8CHAR* It = InText.GetData();
+		const UTF8CHAR* End = It + InText.Len();
+		if (It < End && (*It == '+' || *It == '-'))
+		{
+			++It;
+		}
+		int32 Digits = 0;
+		for (; It < End && IsDigit(*It); ++It)
+		{
+			++Digits;
+		}
+		if (It < End && *It == '.')
+		{
+			for (++It; It < End && IsDigit(*It); ++It)
+			{
+				++Digits;
+			}
+		}
+		if (Digits == 0)
+		{
+			return false;
+		}
+		if (It < End && (*It == 'e' || *It == 'E'))
+		{
+			++It;
+			if (It < End && (*It == '+' || *It == '-'))
+			{
+				++It;
+			}
+			int32 ExponentDigits = 0;
+			for (; It < End && IsDigit(*It); ++It)
+			{
+				++ExponentDigits;
+			}
+			if (ExponentDigits == 0)
+			{
+				return false;
+			}
+		}
+		return It == End;
+	}
+
+	bool ParseNumber(FUtf8StringView InText, double& OutValue)
+	{
+		if (!IsNumber(InText))
+		{
+			return false;
+		}
+		TStringBuilder<64> Number;
+		Number.Append(InText.GetData(), InText.Len());
+		OutValue = FCString::Atod(*Number);
+		return true;
+	}
+}
@@ -0,0 +1,18 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Reading of typed values from UTF-8 csv cells, shared by the typed table and the csv queries */
+namespace FileHelperCsvValue
+{
+	/** Optional sign followed by digits only, fails when the value does not fit in an int64 */
+	bool ParseInt(FUtf8StringView InText, int64& OutValue);
+
+	/** Decimal number with optional sign, fraction and exponent, hexadecimal, inf and nan are not numbers */
+	bool IsNumber(FUtf8StringView InText);
+
+	/** Reads a number when the text is one */
+	bool ParseNumber(FUtf8StringView InText, double& OutValue);
+}
@@ -0,0 +1,123 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperCsvWriter.h"
+
+#include "FileHelperFileAppender.h"
+#include "FileHelperNative.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/ScopeLock.h"
+
+namespace FileHelperCsvWriter
+{
+	/** Flushed blocks that can wait for the disk before a flush blocks the calling thread */
+	static constexpr int64 MaxPendingBlocks = 16;
+}
+
+UFileHelperCSVWriter* UFileHelperCSVWriter::OpenCSVWriter(const FString& Path, const TArray<FString>& Headers, FString& Error, bool Append, bool Force, bool QuoteAll, int32 FlushSizeBytes, float FlushIntervalSeconds)
+{
+	using namespace FileHelperCsvWriter;
+
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	if (!Append && !Force && FileManager.FileExists(*Path))
+	{
+		Error = FString("File already exists");
+		return nullptr;
+	}
+
+	// The header is only written at the start of the file
+	const bool bWriteHeader = !Headers.IsEmpty() && (!Append || FileManager.FileSize(*Path) <= 0);
+
+	UFileHelperFileAppender* Appender = UFileHelperFileAppender::OpenAppender(Path, Error, !Append, FlushSizeBytes, FlushIntervalSeconds);
+	if (!Appender)
+	{
+		return nullptr;
+	}
+	Appender->SetMaxPendingBytes(FMath::Max<int64>(FlushSizeBytes, 1) * MaxPendingBlocks);
+
+	UFileHelperCSVWriter* Writer = NewObject<UFileHelperCSVWriter>();
+	Writer->Appender = Appender;
+	Writer->ColumnCount = Headers.Num();
+	Writer->bQuoteAll = QuoteAll;
+
+	if (bWriteHeader)
+	{
+		FFileHelperNative::AppendCSVRow(Writer->RowText, Headers, QuoteAll);
+		Appender->Write(Writer->RowText);
+	}
+	return Writer;
+}
+
+bool UFileHelperCSVWriter::AppendRow(const TArray<FString>& Cells)
+{
+	FScopeLock Lock(&RowLock);
+	if (!Appender || (ColumnCount > 0 && Cells.Num() != ColumnCount))
+	{
+		return false;
+	}
+	RowText.Reset();
+	FFileHelperNative::AppendCSVRow(RowText, Cells, bQuoteAll);
+	if (!Appender->Write(RowText))
+	{
+		return false;
+	}
+	RowCount++;
+	return true;
+}
+
+bool UFileHelperCSVWriter::AppendNumberRow(const TArray<double>& Values)
+{
+	TArray<FString> Cells;
+	Cells.Reserve(Values.Num());
+	for (const double Value : Values)
+	{
+		Cells.Add(FormatNumber(Value));
+	}
+	return AppendRow(Cells);
+}
+
+void UFileHelperCSVWriter::Flush()
+{
+	FScopeLock Lock(&RowLock);
+	if (Appender)
+	{
+		Appender->Flush();
+	}
+}
+
+void UFileHelperCSVWriter::Close()
+{
+	FScopeLock Lock(&RowLock);
+	if (Appender)
+	{
+		Appender->Close();
+	}
+}
+
+bool UFileHelperCSVWriter::IsOpen() const
+{
+	FScopeLock Lock(&RowLock);
+	return Appender && Appender->IsOpen();
+}
+
+bool UFileHelperCSVWriter::HasWriteError() const
+{
+	FScopeLock Lock(&RowLock);
+	return Appender && Appender->HasWriteError();
+}
+
+int32 UFileHelperCSVWriter::GetRowCount() const
+{
+	FScopeLock Lock(&RowLock);
+	return RowCount;
+}
+
+FString UFileHelperCSVWriter::FormatNumber(double InValue)
+{
+	// 15 digits reads well for most values, 17 always round trips
+	FString Text = FString::Printf(TEXT("%.15g"), InValue);
+	if (FCString::Atod(*Text) != InValue)
+	{
+		Text = FString::Printf(TEXT("%.17g"), InValue);
+	}
+	return Text;
+}
@@ -0,0 +1,121 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperExportPlan.h"
+
+#include "DataTableUtils.h"
+#include "Misc/DelayedAutoRegister.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/UnrealType.h"
+
+namespace FileHelperExportPlan
+{
+	struct FEntry
+	{
+		TSharedPtr<const FFileHelperExportPlan> Plan;
+
+		/** Layout of the struct when the plan was built, a recompiled struct gets new properties */
+		const FProperty* PropertyLink = nullptr;
+		int32 StructureSize = 0;
+	};
+
+	FRWLock CacheLock;
+	TMap<TObjectKey<UScriptStruct>, FEntry> Cache;
+
+	EFileHelperExportKind GetKind(const FProperty* InProperty)
+	{
+		if (CastField<const FEnumProperty>(InProperty))
+		{
+			return EFileHelperExportKind::Enum;
+		}
+		if (const FNumericProperty* NumProp = CastField<const FNumericProperty>(InProperty))
+		{
+			if (NumProp->IsEnum())
+			{
+				return EFileHelperExportKind::Enum;
+			}
+			return NumProp->IsInteger() ? EFileHelperExportKind::Integer : EFileHelperExportKind::Float;
+		}
+		if (CastField<const FBoolProperty>(InProperty))
+		{
+			return EFileHelperExportKind::Bool;
+		}
+		if (CastField<const FArrayProperty>(InProperty))
+		{
+			return EFileHelperExportKind::Array;
+		}
+		if (CastField<const FSetProperty>(InProperty))
+		{
+			return EFileHelperExportKind::Set;
+		}
+		if (CastField<const FMapProperty>(InProperty))
+		{
+			return EFileHelperExportKind::Map;
+		}
+		if (CastField<const FStructProperty>(InProperty))
+		{
+			return EFileHelperExportKind::Struct;
+		}
+		return EFileHelperExportKind::Text;
+	}
+
+	/** Plans are rebuilt after hot reload or when a struct is reinstanced */
+	static FDelayedAutoRegisterHelper RegisterInvalidation(EDelayedRegisterRunPhase::EndOfEngineInit, []()
+	{
+		FCoreUObjectDelegates::OnObjectsReinstanced.AddStatic([](const TMap<UObject*, UObject*>&)
+		{
+			FFileHelperExportPlan::Reset();
+		});
+		FCoreUObjectDelegates::ReloadCompleteDelegate.AddStatic([](EReloadCompleteReason)
+		{
+			FFileHelperExportPlan::Reset();
+		});
+	});
+}
+
+TSharedRef<const FFileHelperExportPlan> FFileHelperExportPlan::Get(const UScriptStruct* InStruct)
+{
+	using namespace FileHelperExportPlan;
+
+	check(InStruct);
+	{
+		FReadScopeLock Lock(CacheLock);
+		if (const FEntry* Entry = Cache.Find(InStruct))
+		{
+			if (Entry->PropertyLink == InStruct->PropertyLink && Entry->StructureSize == InStruct->GetStructureSize())
+			{
+				return Entry->Plan.ToSharedRef();
+			}
+		}
+	}
+
+	// Built outside of the lock, nested struct plans are looked up while building
+	TSharedRef<FFileHelperExportPlan> Plan = MakeShared<FFileHelperExportPlan>();
+	for (TFieldIterator<const FProperty> It(InStruct); It; ++It)
+	{
+		const FProperty* Property = *It;
+		check(Property);
+
+		FFileHelperExportField& Field = Plan->Fields.AddDefaulted_GetRef();
+		Field.Property = Property;
+		Field.CsvName = DataTableUtils::GetPropertyExportName(Property, EDataTableExportFlags::None);
+		Field.JsonName = DataTableUtils::GetPropertyExportName(Property, EDataTableExportFlags::UseJsonObjectsForStructs);
+		Field.Kind = GetKind(Property);
+		if (Field.Kind == EFileHelperExportKind::Struct)
+		{
+			Field.StructPlan = Get(CastFieldChecked<const FStructProperty>(Property)->Struct);
+		}
+	}
+
+	FWriteScopeLock Lock(CacheLock);
+	FEntry& Entry = Cache.FindOrAdd(InStruct);
+	Entry.Plan = Plan;
+	Entry.PropertyLink = InStruct->PropertyLink;
+	Entry.StructureSize = InStruct->GetStructureSize();
+	return Plan;
+}
+
+void FFileHelperExportPlan::Reset()
+{
+	FWriteScopeLock Lock(FileHelperExportPlan::CacheLock);
+	FileHelperExportPlan::Cache.Empty();
+}
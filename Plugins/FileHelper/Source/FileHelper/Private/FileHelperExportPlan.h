@@ -0,0 +1,60 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FFileHelperExportPlan;
+
+/** How a field is written to json, resolved once from its property type */
+enum class EFileHelperExportKind : uint8
+{
+	/** Enum name through DataTableUtils */
+	Enum,
+	Integer,
+	Float,
+	Bool,
+	Array,
+	Set,
+	Map,
+	Struct,
+	/** Any other property, exported as text through DataTableUtils */
+	Text
+};
+
+struct FFileHelperExportField
+{
+	const FProperty* Property = nullptr;
+
+	/** Export names of the field, see DataTableUtils::GetPropertyExportName */
+	FString CsvName;
+	FString JsonName;
+
+	EFileHelperExportKind Kind = EFileHelperExportKind::Text;
+
+	/** Plan of the struct of a struct field */
+	TSharedPtr<const FFileHelperExportPlan> StructPlan;
+};
+
+/**
+ * Ordered fields of a struct with their export names and writers resolved,
+ * built once per struct and shared by every row of the datatable exports,
+ * plans are dropped when structs are reinstanced or reloaded and can be read from any thread
+ */
+class FFileHelperExportPlan
+{
+public:
+	/** Cached plan of a struct, built on first use */
+	static TSharedRef<const FFileHelperExportPlan> Get(const UScriptStruct* InStruct);
+
+	/** Drops every cached plan */
+	static void Reset();
+
+	TConstArrayView<FFileHelperExportField> GetFields() const
+	{
+		return Fields;
+	}
+
+private:
+	TArray<FFileHelperExportField> Fields;
+};
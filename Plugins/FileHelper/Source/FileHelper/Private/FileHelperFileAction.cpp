@@ -0,0 +1,374 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperFileAction.h"
+
+#include "Async/Async.h"
+#include "FileHelperBPLibrary.h"
+
+UFileHelperTextFileAction* UFileHelperTextFileAction::ReadTextAsync(const FString& Path)
+{
+	return CreateNode(EOperation::ReadText, Path);
+}
+
+UFileHelperTextFileAction* UFileHelperTextFileAction::SaveTextAsync(const FString& Path, const FString& Text, bool Append, bool Force)
+{
+	UFileHelperTextFileAction* Node = CreateNode(EOperation::SaveText, Path);
+	Node->Text = Text;
+	Node->bAppend = Append;
+	Node->bForce = Force;
+	return Node;
+}
+
+UFileHelperTextFileAction* UFileHelperTextFileAction::ReadLineAsync(const FString& Path, const FString& Pattern, EFileHelperPatternMode Mode)
+{
+	UFileHelperTextFileAction* Node = CreateNode(EOperation::ReadLine, Path);
+	Node->Text = Pattern;
+	Node->PatternMode = Mode;
+	return Node;
+}
+
+UFileHelperTextFileAction* UFileHelperTextFileAction::ReadLineRangeAsync(const FString& Path, int32 StartIdx, int32 EndIdx)
+{
+	UFileHelperTextFileAction* Node = CreateNode(EOperation::ReadLineRange, Path);
+	Node->StartIdx = StartIdx;
+	Node->EndIdx = EndIdx;
+	return Node;
+}
+
+UFileHelperTextFileAction* UFileHelperTextFileAction::ReadLineTailAsync(const FString& Path, int32 Count)
+{
+	UFileHelperTextFileAction* Node = CreateNode(EOperation::ReadLineTail, Path);
+	Node->EndIdx = Count;
+	return Node;
+}
+
+UFileHelperTextFileAction* UFileHelperTextFileAction::BuildLineIndexAsync(const FString& Path)
+{
+	return CreateNode(EOperation::BuildLineIndex, Path);
+}
+
+UFileHelperTextFileAction* UFileHelperTextFileAction::SaveLineAsync(const FString& Path, const TArray<FString>& Lines, bool Append, bool Force)
+{
+	UFileHelperTextFileAction* Node = CreateNode(EOperation::SaveLine, Path);
+	Node->Lines = Lines;
+	Node->bAppend = Append;
+	Node->bForce = Force;
+	return Node;
+}
+
+UFileHelperTextFileAction* UFileHelperTextFileAction::CreateNode(EOperation InOperation, const FString& InPath)
+{
+	UFileHelperTextFileAction* Node = NewObject<UFileHelperTextFileAction>();
+	Node->Operation = InOperation;
+	Node->Path = InPath;
+	Node->bActive = false;
+	return Node;
+}
+
+void UFileHelperTextFileAction::Activate()
+{
+	if (bActive)
+	{
+		FFrame::KismetExecutionMessage(TEXT("TextFileAction is already running"), ELogVerbosity::Warning);
+		Failed.Broadcast(FString(), TArray<FString>(), FString("Action is already running"));
+		return;
+	}
+
+	bActive = true;
+
+	// Inputs are moved to the worker, the node only keeps its pins and state
+	TWeakObjectPtr<UFileHelperTextFileAction> ThisWeak(this);
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [ThisWeak, InOperation = Operation, InPath = MoveTemp(Path), InText = MoveTemp(Text), InLines = MoveTemp(Lines), InPatternMode = PatternMode, InStartIdx = StartIdx, InEndIdx = EndIdx, bInAppend = bAppend, bInForce = bForce]() mutable
+	{
+		bool bResult = false;
+		FString OutText;
+		TArray<FString> OutLines;
+		FString OutError;
+
+		switch (InOperation)
+		{
+		case EOperation::ReadText:
+			bResult = UFileHelperBPLibrary::ReadText(MoveTemp(InPath), OutText);
+			break;
+		case EOperation::SaveText:
+			bResult = UFileHelperBPLibrary::SaveText(MoveTemp(InPath), MoveTemp(InText), OutError, bInAppend, bInForce);
+			break;
+		case EOperation::ReadLine:
+			bResult = UFileHelperBPLibrary::ReadLine(MoveTemp(InPath), MoveTemp(InText), OutLines, InPatternMode);
+			break;
+		case EOperation::ReadLineRange:
+			bResult = UFileHelperBPLibrary::ReadLineRange(MoveTemp(InPath), OutLines, InStartIdx, InEndIdx);
+			break;
+		case EOperation::ReadLineTail:
+			bResult = UFileHelperBPLibrary::ReadLineTail(MoveTemp(InPath), OutLines, InEndIdx);
+			break;
+		case EOperation::BuildLineIndex:
+			bResult = UFileHelperBPLibrary::BuildLineIndex(MoveTemp(InPath));
+			break;
+		case EOperation::SaveLine:
+			bResult = UFileHelperBPLibrary::SaveLine(MoveTemp(InPath), InLines, OutError, bInAppend, bInForce);
+			break;
+		}
+
+		AsyncTask(ENamedThreads::Type::GameThread, [ThisWeak, bResult, OutText = MoveTemp(OutText), OutLines = MoveTemp(OutLines), OutError = MoveTemp(OutError)]() mutable
+		{
+			if (UFileHelperTextFileAction* This = ThisWeak.Get())
+			{
+				This->OnTaskCompleted(bResult, MoveTemp(OutText), MoveTemp(OutLines), MoveTemp(OutError));
+			}
+		});
+	});
+}
+
+void UFileHelperTextFileAction::OnTaskCompleted(bool bInSuccess, FString&& InText, TArray<FString>&& InLines, FString&& InError)
+{
+	Reset();
+
+	if (bInSuccess)
+	{
+		Completed.Broadcast(InText, InLines, InError);
+	}
+	else
+	{
+		Failed.Broadcast(InText, InLines, InError);
+	}
+}
+
+void UFileHelperTextFileAction::Reset()
+{
+	bActive = false;
+	Path.Empty();
+	Text.Empty();
+	Lines.Empty();
+}
+
+UFileHelperByteFileAction* UFileHelperByteFileAction::ReadByteAsync(const FString& Path)
+{
+	UFileHelperByteFileAction* Node = NewObject<UFileHelperByteFileAction>();
+	Node->bSave = false;
+	Node->Path = Path;
+	Node->bActive = false;
+	return Node;
+}
+
+UFileHelperByteFileAction* UFileHelperByteFileAction::SaveByteAsync(const FString& Path, const TArray<uint8>& Bytes, bool Append, bool Force)
+{
+	UFileHelperByteFileAction* Node = NewObject<UFileHelperByteFileAction>();
+	Node->bSave = true;
+	Node->Path = Path;
+	Node->Bytes = Bytes;
+	Node->bAppend = Append;
+	Node->bForce = Force;
+	Node->bActive = false;
+	return Node;
+}
+
+void UFileHelperByteFileAction::Activate()
+{
+	if (bActive)
+	{
+		FFrame::KismetExecutionMessage(TEXT("ByteFileAction is already running"), ELogVerbosity::Warning);
+		Failed.Broadcast(TArray<uint8>(), FString("Action is already running"));
+		return;
+	}
+
+	bActive = true;
+
+	TWeakObjectPtr<UFileHelperByteFileAction> ThisWeak(this);
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [ThisWeak, bInSave = bSave, InPath = MoveTemp(Path), InBytes = MoveTemp(Bytes), bInAppend = bAppend, bInForce = bForce]() mutable
+	{
+		bool bResult = false;
+		TArray<uint8> OutBytes;
+		FString OutError;
+
+		if (bInSave)
+		{
+			bResult = UFileHelperBPLibrary::SaveByte(MoveTemp(InPath), InBytes, OutError, bInAppend, bInForce);
+		}
+		else
+		{
+			bResult = UFileHelperBPLibrary::ReadByte(MoveTemp(InPath), OutBytes);
+		}
+
+		AsyncTask(ENamedThreads::Type::GameThread, [ThisWeak, bResult, OutBytes = MoveTemp(OutBytes), OutError = MoveTemp(OutError)]() mutable
+		{
+			if (UFileHelperByteFileAction* This = ThisWeak.Get())
+			{
+				This->OnTaskCompleted(bResult, MoveTemp(OutBytes), MoveTemp(OutError));
+			}
+		});
+	});
+}
+
+void UFileHelperByteFileAction::OnTaskCompleted(bool bInSuccess, TArray<uint8>&& InBytes, FString&& InError)
+{
+	Reset();
+
+	if (bInSuccess)
+	{
+		Completed.Broadcast(InBytes, InError);
+	}
+	else
+	{
+		Failed.Broadcast(InBytes, InError);
+	}
+}
+
+void UFileHelperByteFileAction::Reset()
+{
+	bActive = false;
+	Path.Empty();
+	Bytes.Empty();
+}
+
+UFileHelperCSVFileAction* UFileHelperCSVFileAction::ReadCSVAsync(const FString& Path, bool HeaderFirst, bool Parallel, bool UseCache)
+{
+	UFileHelperCSVFileAction* Node = NewObject<UFileHelperCSVFileAction>();
+	Node->bSave = false;
+	Node->Path = Path;
+	Node->bHeaderFirst = HeaderFirst;
+	Node->bParallel = Parallel;
+	Node->bUseCache = UseCache;
+	Node->bActive = false;
+	return Node;
+}
+
+UFileHelperCSVFileAction* UFileHelperCSVFileAction::SaveCSVAsync(const FString& Path, const TArray<FString>& Headers, const TArray<FString>& Data, bool Force)
+{
+	UFileHelperCSVFileAction* Node = NewObject<UFileHelperCSVFileAction>();
+	Node->bSave = true;
+	Node->Path = Path;
+	Node->Headers = Headers;
+	Node->Data = Data;
+	Node->bForce = Force;
+	Node->bActive = false;
+	return Node;
+}
+
+void UFileHelperCSVFileAction::Activate()
+{
+	if (bActive)
+	{
+		FFrame::KismetExecutionMessage(TEXT("CSVFileAction is already running"), ELogVerbosity::Warning);
+		Failed.Broadcast(TArray<FString>(), TArray<FString>(), 0);
+		return;
+	}
+
+	bActive = true;
+
+	TWeakObjectPtr<UFileHelperCSVFileAction> ThisWeak(this);
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [ThisWeak, bInSave = bSave, InPath = MoveTemp(Path), InHeaders = MoveTemp(Headers), InData = MoveTemp(Data), bInHeaderFirst = bHeaderFirst, bInParallel = bParallel, bInUseCache = bUseCache, bInForce = bForce]() mutable
+	{
+		bool bResult = false;
+		TArray<FString> OutHeaders;
+		TArray<FString> OutData;
+		int32 OutTotal = 0;
+
+		if (bInSave)
+		{
+			bResult = UFileHelperBPLibrary::SaveCSV(MoveTemp(InPath), InHeaders, InData, OutTotal, bInForce);
+		}
+		else
+		{
+			bResult = UFileHelperBPLibrary::ReadCSV(MoveTemp(InPath), OutHeaders, OutData, OutTotal, bInHeaderFirst, bInParallel, bInUseCache);
+		}
+
+		AsyncTask(ENamedThreads::Type::GameThread, [ThisWeak, bResult, OutHeaders = MoveTemp(OutHeaders), OutData = MoveTemp(OutData), OutTotal]() mutable
+		{
+			if (UFileHelperCSVFileAction* This = ThisWeak.Get())
+			{
+				This->OnTaskCompleted(bResult, MoveTemp(OutHeaders), MoveTemp(OutData), OutTotal);
+			}
+		});
+	});
+}
+
+void UFileHelperCSVFileAction::OnTaskCompleted(bool bInSuccess, TArray<FString>&& InHeaders, TArray<FString>&& InData, int32 InTotal)
+{
+	Reset();
+
+	if (bInSuccess)
+	{
+		Completed.Broadcast(InHeaders, InData, InTotal);
+	}
+	else
+	{
+		Failed.Broadcast(InHeaders, InData, InTotal);
+	}
+}
+
+void UFileHelperCSVFileAction::Reset()
+{
+	bActive = false;
+	Path.Empty();
+	Headers.Empty();
+	Data.Empty();
+}
+
+UFileHelperHashFileAction* UFileHelperHashFileAction::HashFileAsync(const FString& Path, EFileHelperHashAlgorithm Algorithm)
+{
+	UFileHelperHashFileAction* Node = NewObject<UFileHelperHashFileAction>();
+	Node->bFingerprint = false;
+	Node->Path = Path;
+	Node->Algorithm = Algorithm;
+	Node->bActive = false;
+	return Node;
+}
+
+UFileHelperHashFileAction* UFileHelperHashFileAction::FingerprintFileAsync(const FString& Path)
+{
+	UFileHelperHashFileAction* Node = NewObject<UFileHelperHashFileAction>();
+	Node->bFingerprint = true;
+	Node->Path = Path;
+	Node->bActive = false;
+	return Node;
+}
+
+void UFileHelperHashFileAction::Activate()
+{
+	if (bActive)
+	{
+		FFrame::KismetExecutionMessage(TEXT("HashFileAction is already running"), ELogVerbosity::Warning);
+		Failed.Broadcast(FString());
+		return;
+	}
+
+	bActive = true;
+
+	TWeakObjectPtr<UFileHelperHashFileAction> ThisWeak(this);
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [ThisWeak, bInFingerprint = bFingerprint, InPath = MoveTemp(Path), InAlgorithm = Algorithm]() mutable
+	{
+		FString OutHash;
+		const bool bResult = bInFingerprint
+			? UFileHelperBPLibrary::FingerprintFile(MoveTemp(InPath), OutHash)
+			: UFileHelperBPLibrary::HashFile(MoveTemp(InPath), OutHash, InAlgorithm);
+
+		AsyncTask(ENamedThreads::Type::GameThread, [ThisWeak, bResult, OutHash = MoveTemp(OutHash)]() mutable
+		{
+			if (UFileHelperHashFileAction* This = ThisWeak.Get())
+			{
+				This->OnTaskCompleted(bResult, MoveTemp(OutHash));
+			}
+		});
+	});
+}
+
+void UFileHelperHashFileAction::OnTaskCompleted(bool bInSuccess, FString&& InHash)
+{
+	Reset();
+
+	if (bInSuccess)
+	{
+		Completed.Broadcast(InHash);
+	}
+	else
+	{
+		Failed.Broadcast(InHash);
+	}
+}
+
+void UFileHelperHashFileAction::Reset()
+{
+	bActive = false;
+	Path.Empty();
+}
@@ -0,0 +1,213 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperFileAppender.h"
+
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+UFileHelperFileAppender::FWriterState::~FWriterState()
+{
+	if (Handle.IsValid())
+	{
+		Handle->Flush();
+	}
+}
+
+UFileHelperFileAppender* UFileHelperFileAppender::OpenAppender(const FString& Path, FString& Error, bool Truncate, int32 FlushSizeBytes, float FlushIntervalSeconds)
+{
+	FText ErrorFilename;
+	if (!FFileHelper::IsFilenameValidForSaving(Path, ErrorFilename))
+	{
+		Error = FString("Filename is not valid");
+		return nullptr;
+	}
+
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	const FString Directory = FPaths::GetPath(Path);
+	if (!Directory.IsEmpty() && !FileManager.DirectoryExists(*Directory) && !FileManager.CreateDirectoryTree(*Directory))
+	{
+		Error = FString("Directory cannot be created");
+		return nullptr;
+	}
+
+	TSharedPtr<FWriterState, ESPMode::ThreadSafe> State = MakeShared<FWriterState, ESPMode::ThreadSafe>();
+	State->Handle.Reset(FileManager.OpenWrite(*Path, !Truncate, /** AllowRead */true));
+	if (!State->Handle.IsValid())
+	{
+		Error = FString("File cannot be opened");
+		return nullptr;
+	}
+
+	UFileHelperFileAppender* Appender = NewObject<UFileHelperFileAppender>();
+	Appender->Path = Path;
+	Appender->State = MoveTemp(State);
+	Appender->FlushSize = FMath::Max(FlushSizeBytes, 0);
+	Appender->FlushInterval = FlushIntervalSeconds;
+	Appender->LastFlushTime = FPlatformTime::Seconds();
+	Appender->Buffer.Reserve(Appender->FlushSize);
+
+	if (Appender->FlushInterval > 0.f)
+	{
+		TWeakObjectPtr<UFileHelperFileAppender> AppenderWeak(Appender);
+		Appender->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([AppenderWeak](float InDeltaTime)
+		{
+			UFileHelperFileAppender* This = AppenderWeak.Get();
+			return This && This->Tick(InDeltaTime);
+		}));
+	}
+
+	return Appender;
+}
+
+bool UFileHelperFileAppender::Write(const FString& Text)
+{
+	return Append(*Text, Text.Len());
+}
+
+bool UFileHelperFileAppender::WriteLine(const FString& Text)
+{
+	FScopeLock Lock(&BufferLock);
+	return Append(*Text, Text.Len()) && Append(LINE_TERMINATOR, FCString::Strlen(LINE_TERMINATOR));
+}
+
+bool UFileHelperFileAppender::Append(const TCHAR* InText, int32 InLen)
+{
+	FScopeLock Lock(&BufferLock);
+	if (!State.IsValid())
+	{
+		return false;
+	}
+
+	if (InLen > 0)
+	{
+		const FTCHARToUTF8 Converted(InText, InLen);
+		Buffer.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	}
+
+	if (Buffer.Num() >= FlushSize)
+	{
+		FlushLocked(false);
+	}
+	return true;
+}
+
+void UFileHelperFileAppender::Flush()
+{
+	FScopeLock Lock(&BufferLock);
+	FlushLocked(false);
+}
+
+void UFileHelperFileAppender::Close()
+{
+	FScopeLock Lock(&BufferLock);
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+	FlushLocked(true);
+}
+
+bool UFileHelperFileAppender::IsOpen() const
+{
+	FScopeLock Lock(&BufferLock);
+	return State.IsValid();
+}
+
+bool UFileHelperFileAppender::HasWriteError() const
+{
+	FScopeLock Lock(&BufferLock);
+	return State.IsValid() && State->bWriteError;
+}
+
+void UFileHelperFileAppender::WaitForWrites() const
+{
+	UE::Tasks::FTask Task;
+	{
+		FScopeLock Lock(&BufferLock);
+		Task = LastWrite;
+	}
+	if (Task.IsValid())
+	{
+		Task.Wait();
+	}
+}
+
+void UFileHelperFileAppender::SetMaxPendingBytes(int64 InMaxPendingBytes)
+{
+	FScopeLock Lock(&BufferLock);
+	MaxPendingBytes = InMaxPendingBytes;
+}
+
+void UFileHelperFileAppender::BeginDestroy()
+{
+	Close();
+	Super::BeginDestroy();
+}
+
+void UFileHelperFileAppender::FlushLocked(bool bInClose)
+{
+	if (!State.IsValid())
+	{
+		return;
+	}
+
+	LastFlushTime = FPlatformTime::Seconds();
+	if (Buffer.IsEmpty() && !bInClose)
+	{
+		return;
+	}
+
+	// Memory stays bounded when the disk is slower than the writer
+	if (MaxPendingBytes > 0 && State->PendingBytes > MaxPendingBytes && LastWrite.IsValid())
+	{
+		LastWrite.Wait();
+	}
+	State->PendingBytes += Buffer.Num();
+
+	// The last write releases the state and closes the file once every previous write is done
+	TSharedPtr<FWriterState, ESPMode::ThreadSafe> WriterState = bInClose ? MoveTemp(State) : State;
+	auto WriteTask = [WriterState = MoveTemp(WriterState), Bytes = MoveTemp(Buffer), bInClose]() mutable
+	{
+		if (!Bytes.IsEmpty() && !WriterState->Handle->Write(Bytes.GetData(), Bytes.Num()))
+		{
+			WriterState->bWriteError = true;
+		}
+		WriterState->PendingBytes -= Bytes.Num();
+		if (bInClose)
+		{
+			WriterState.Reset();
+		}
+	};
+
+	if (LastWrite.IsValid())
+	{
+		LastWrite = UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(WriteTask), UE::Tasks::Prerequisites(LastWrite));
+	}
+	else
+	{
+		LastWrite = UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(WriteTask));
+	}
+
+	Buffer.Reset();
+	if (!bInClose)
+	{
+		Buffer.Reserve(FlushSize);
+	}
+}
+
+bool UFileHelperFileAppender::Tick(float InDeltaTime)
+{
+	FScopeLock Lock(&BufferLock);
+	if (!State.IsValid())
+	{
+		return false;
+	}
+	if (!Buffer.IsEmpty() && FPlatformTime::Seconds() - LastFlushTime >= FlushInterval)
+	{
+		FlushLocked(false);
+	}
+	return true;
+}
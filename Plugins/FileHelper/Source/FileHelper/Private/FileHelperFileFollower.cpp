@@ -0,0 +1,286 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperFileFollower.h"
+
+#include "Async/Async.h"
+#include "FileHelperSIMD.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Paths.h"
+#include <atomic>
+
+#if PLATFORM_LINUX
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+/** Background loop waiting for changes and reading the appended bytes */
+class FFileHelperFollowRunnable : public FRunnable
+{
+public:
+	FFileHelperFollowRunnable(UFileHelperFileFollower* InOwner, const FString& InPath, int64 InOffset, float InPollInterval)
+		: Owner(InOwner)
+		, Path(InPath)
+		, Offset(InOffset)
+		, PollIntervalMs(FMath::Max(FMath::RoundToInt(InPollInterval * 1000.f), 10))
+		, WakeEvent(FPlatformProcess::GetSynchEventFromPool())
+	{}
+
+	virtual ~FFileHelperFollowRunnable() override
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	}
+
+	//~ Begin FRunnable
+	virtual uint32 Run() override;
+
+	virtual void Stop() override
+	{
+		bStopping = true;
+		WakeEvent->Trigger();
+	}
+	//~ End FRunnable
+
+private:
+	/** Waits until the file may have changed or the interval elapsed */
+	void WaitForChange();
+
+	/** Reads the bytes appended since the last offset and sends the complete lines */
+	void ReadAppended();
+
+	TWeakObjectPtr<UFileHelperFileFollower> Owner;
+
+	FString Path;
+
+	/** Offset of the first byte not read yet */
+	int64 Offset = 0;
+
+	/** Bytes of the last line, waiting for its line break */
+	TArray<uint8> Pending;
+
+	int32 PollIntervalMs = 250;
+
+	FEvent* WakeEvent = nullptr;
+
+	std::atomic<bool> bStopping{ false };
+
+#if PLATFORM_LINUX
+	void CloseWatch();
+
+	int32 NotifyFd = -1;
+	int32 WatchFd = -1;
+#endif
+};
+
+uint32 FFileHelperFollowRunnable::Run()
+{
+	while (!bStopping)
+	{
+		ReadAppended();
+		WaitForChange();
+	}
+#if PLATFORM_LINUX
+	CloseWatch();
+#endif
+	return 0;
+}
+
+#if PLATFORM_LINUX
+void FFileHelperFollowRunnable::CloseWatch()
+{
+	if (NotifyFd >= 0)
+	{
+		close(NotifyFd);
+		NotifyFd = -1;
+		WatchFd = -1;
+	}
+}
+
+void FFileHelperFollowRunnable::WaitForChange()
+{
+	// The watch is created lazily since the file may not exist yet, and again after a rotation
+	if (WatchFd < 0)
+	{
+		if (NotifyFd < 0)
+		{
+			NotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		}
+		if (NotifyFd >= 0)
+		{
+			const FString FullPath = FPaths::ConvertRelativePathToFull(Path);
+			WatchFd = inotify_add_watch(NotifyFd, TCHAR_TO_UTF8(*FullPath), IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF);
+		}
+	}
+
+	if (WatchFd < 0)
+	{
+		WakeEvent->Wait(PollIntervalMs);
+		return;
+	}
+
+	// The timeout keeps a polling fallback and bounds the time needed to stop
+	pollfd PollFd = { NotifyFd, POLLIN, 0 };
+	if (poll(&PollFd, 1, PollIntervalMs) <= 0 || !(PollFd.revents & POLLIN))
+	{
+		return;
+	}
+
+	alignas(inotify_event) uint8 Events[4096];
+	ssize_t Size;
+	while ((Size = read(NotifyFd, Events, sizeof(Events))) > 0)
+	{
+		for (uint8* Event = Events; Event < Events + Size; Event += sizeof(inotify_event) + reinterpret_cast<inotify_event*>(Event)->len)
+		{
+			if (reinterpret_cast<inotify_event*>(Event)->mask & (IN_MOVE_SELF | IN_DELETE_SELF | IN_IGNORED))
+			{
+				inotify_rm_watch(NotifyFd, WatchFd);
+				WatchFd = -1;
+			}
+		}
+	}
+}
+#else
+void FFileHelperFollowRunnable::WaitForChange()
+{
+	WakeEvent->Wait(PollIntervalMs);
+}
+#endif
+
+void FFileHelperFollowRunnable::ReadAppended()
+{
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	const int64 FileSize = FileManager.FileSize(*Path);
+	if (FileSize < 0)
+	{
+		return;
+	}
+	if (FileSize < Offset)
+	{
+		// Truncated or replaced, start over
+		Offset = 0;
+		Pending.Reset();
+	}
+	if (FileSize == Offset)
+	{
+		return;
+	}
+
+	TUniquePtr<IFileHandle> Handle(FileManager.OpenRead(*Path, /** AllowWrite */true));
+	if (!Handle.IsValid() || !Handle->Seek(Offset))
+	{
+		return;
+	}
+
+	constexpr int64 ChunkSize = 64 * 1024;
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min(ChunkSize, FileSize - Offset)));
+	TArray<FString> Lines;
+
+	while (Offset < FileSize && !bStopping)
+	{
+		const int64 ReadSize = FMath::Min<int64>(Buffer.Num(), FileSize - Offset);
+		if (!Handle->Read(Buffer.GetData(), ReadSize))
+		{
+			break;
+		}
+
+		const uint8* Cursor = Buffer.GetData();
+		const uint8* End = Cursor + ReadSize;
+		if (Offset == 0 && ReadSize >= 3 && Cursor[0] == 0xEF && Cursor[1] == 0xBB && Cursor[2] == 0xBF)
+		{
+			Cursor += 3;
+		}
+		Offset += ReadSize;
+
+		while (Cursor < End)
+		{
+			const uint8* LineEnd = FileHelperSIMD::FindLineBreak(Cursor, End);
+			if (LineEnd == End)
+			{
+				Pending.Append(Cursor, static_cast<int32>(LineEnd - Cursor));
+				break;
+			}
+
+			if (Pending.Num() > 0)
+			{
+				Pending.Append(Cursor, static_cast<int32>(LineEnd - Cursor));
+				Lines.Emplace(Pending.Num(), reinterpret_cast<const UTF8CHAR*>(Pending.GetData()));
+				Pending.Reset();
+			}
+			else if (LineEnd > Cursor)
+			{
+				Lines.Emplace(static_cast<int32>(LineEnd - Cursor), reinterpret_cast<const UTF8CHAR*>(Cursor));
+			}
+			Cursor = LineEnd + 1;
+		}
+	}
+
+	if (Lines.Num() > 0)
+	{
+		AsyncTask(ENamedThreads::Type::GameThread, [OwnerWeak = Owner, Lines = MoveTemp(Lines)]() mutable
+		{
+			if (UFileHelperFileFollower* Follower = OwnerWeak.Get())
+			{
+				Follower->OnLinesRead(MoveTemp(Lines));
+			}
+		});
+	}
+}
+
+UFileHelperFileFollower::~UFileHelperFileFollower() = default;
+
+UFileHelperFileFollower* UFileHelperFileFollower::FollowFile(const FString& Path, bool FromEnd, float PollIntervalSeconds)
+{
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	const int64 Offset = FromEnd ? FMath::Max<int64>(FileManager.FileSize(*Path), 0) : 0;
+
+	UFileHelperFileFollower* Follower = NewObject<UFileHelperFileFollower>();
+	Follower->Path = Path;
+	Follower->Runnable = MakeUnique<FFileHelperFollowRunnable>(Follower, Path, Offset, PollIntervalSeconds);
+	Follower->Thread.Reset(FRunnableThread::Create(Follower->Runnable.Get(), TEXT("FileHelperFileFollower"), 0, TPri_BelowNormal));
+	if (!Follower->Thread.IsValid())
+	{
+		Follower->Runnable.Reset();
+		return nullptr;
+	}
+	return Follower;
+}
+
+void UFileHelperFileFollower::Stop()
+{
+	if (Thread.IsValid())
+	{
+		Runnable->Stop();
+		Thread->WaitForCompletion();
+		Thread.Reset();
+	}
+	Runnable.Reset();
+}
+
+bool UFileHelperFileFollower::IsFollowing() const
+{
+	return Thread.IsValid();
+}
+
+FString UFileHelperFileFollower::GetPath() const
+{
+	return Path;
+}
+
+void UFileHelperFileFollower::BeginDestroy()
+{
+	Stop();
+	Super::BeginDestroy();
+}
+
+void UFileHelperFileFollower::OnLinesRead(TArray<FString>&& InLines)
+{
+	if (IsFollowing())
+	{
+		OnLinesAppended.Broadcast(InLines);
+	}
+}
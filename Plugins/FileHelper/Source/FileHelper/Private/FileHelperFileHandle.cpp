@@ -0,0 +1,159 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperFileHandle.h"
+
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+UFileHelperFileHandle* UFileHelperFileHandle::OpenFileHandle(const FString& Path, EFileHelperFileAccess Access, FString& Error)
+{
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	TUniquePtr<IFileHandle> Handle;
+
+	if (Access == EFileHelperFileAccess::Read)
+	{
+		if (!FileManager.FileExists(*Path))
+		{
+			Error = FString("File not found");
+			return nullptr;
+		}
+		Handle.Reset(FileManager.OpenRead(*Path, /** AllowWrite */false));
+	}
+	else
+	{
+		FText ErrorFilename;
+		if (!FFileHelper::IsFilenameValidForSaving(Path, ErrorFilename))
+		{
+			Error = FString("Filename is not valid");
+			return nullptr;
+		}
+		const FString Directory = FPaths::GetPath(Path);
+		if (!Directory.IsEmpty() && !FileManager.DirectoryExists(*Directory))
+		{
+			FileManager.CreateDirectoryTree(*Directory);
+		}
+		// Append mode keeps the existing content, every write seeks anyway
+		Handle.Reset(FileManager.OpenWrite(*Path, /** Append */true, /** AllowRead */true));
+	}
+
+	if (!Handle.IsValid())
+	{
+		Error = FString("File cannot be opened");
+		return nullptr;
+	}
+
+	UFileHelperFileHandle* FileHandle = NewObject<UFileHelperFileHandle>();
+	FileHandle->Path = Path;
+	FileHandle->Access = Access;
+	FileHandle->Handle = MoveTemp(Handle);
+	return FileHandle;
+}
+
+bool UFileHelperFileHandle::ReadAt(int64 Offset, int64 Length, TArray<uint8>& Bytes)
+{
+	Bytes.Reset();
+	if (Length < 0 || Length > MAX_int32)
+	{
+		return false;
+	}
+	Bytes.SetNumUninitialized(static_cast<int32>(Length));
+	const int64 Read = ReadInto(Offset, TArrayView64<uint8>(Bytes.GetData(), Length));
+	if (Read < 0)
+	{
+		Bytes.Reset();
+		return false;
+	}
+	Bytes.SetNum(static_cast<int32>(Read));
+	return true;
+}
+
+bool UFileHelperFileHandle::WriteAt(int64 Offset, const TArray<uint8>& Bytes)
+{
+	return WriteFrom(Offset, TConstArrayView64<uint8>(Bytes.GetData(), Bytes.Num()));
+}
+
+int64 UFileHelperFileHandle::ReadInto(int64 InOffset, TArrayView64<uint8> OutBytes)
+{
+	FScopeLock Lock(&HandleLock);
+	if (!Handle.IsValid() || InOffset < 0)
+	{
+		return -1;
+	}
+
+	const int64 Length = FMath::Min(OutBytes.Num(), FMath::Max<int64>(Handle->Size() - InOffset, 0));
+	if (Length == 0)
+	{
+		return 0;
+	}
+
+	if (!Handle->Seek(InOffset) || !Handle->Read(OutBytes.GetData(), Length))
+	{
+		return -1;
+	}
+	return Length;
+}
+
+bool UFileHelperFileHandle::WriteFrom(int64 InOffset, TConstArrayView64<uint8> InBytes)
+{
+	FScopeLock Lock(&HandleLock);
+	if (!Handle.IsValid() || Access != EFileHelperFileAccess::ReadWrite || InOffset < 0)
+	{
+		return false;
+	}
+	if (InBytes.IsEmpty())
+	{
+		return true;
+	}
+	return Handle->Seek(InOffset) && Handle->Write(InBytes.GetData(), InBytes.Num());
+}
+
+bool UFileHelperFileHandle::Truncate(int64 Size)
+{
+	FScopeLock Lock(&HandleLock);
+	if (!Handle.IsValid() || Access != EFileHelperFileAccess::ReadWrite || Size < 0)
+	{
+		return false;
+	}
+	return Handle->Truncate(Size);
+}
+
+bool UFileHelperFileHandle::Flush()
+{
+	FScopeLock Lock(&HandleLock);
+	return Handle.IsValid() && Handle->Flush();
+}
+
+void UFileHelperFileHandle::Close()
+{
+	FScopeLock Lock(&HandleLock);
+	if (Handle.IsValid())
+	{
+		Handle->Flush();
+		Handle.Reset();
+	}
+}
+
+bool UFileHelperFileHandle::IsOpen() const
+{
+	FScopeLock Lock(&HandleLock);
+	return Handle.IsValid();
+}
+
+int64 UFileHelperFileHandle::GetSize() const
+{
+	FScopeLock Lock(&HandleLock);
+	return Handle.IsValid() ? Handle->Size() : -1;
+}
+
+FString UFileHelperFileHandle::GetPath() const
+{
+	return Path;
+}
+
+void UFileHelperFileHandle::BeginDestroy()
+{
+	Close();
+	Super::BeginDestroy();
+}
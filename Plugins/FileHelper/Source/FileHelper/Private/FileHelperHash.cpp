@@ -0,0 +1,215 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperHash.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/Blake3.h"
+#include "Hash/xxhash.h"
+#include <atomic>
+
+namespace FileHelperHash
+{
+	/** Size of the reads when streaming a file */
+	static constexpr int64 ReadSize = 256 * 1024;
+
+	/** Incremental hasher for the selected algorithm */
+	class FHasher
+	{
+	public:
+		explicit FHasher(EFileHelperHashAlgorithm InAlgorithm)
+			: Algorithm(InAlgorithm)
+		{}
+
+		void Update(const void* InData, uint64 InSize)
+		{
+			if (Algorithm == EFileHelperHashAlgorithm::Blake3)
+			{
+				Blake3.Update(InData, InSize);
+			}
+			else
+			{
+				XxHash.Update(InData, InSize);
+			}
+		}
+
+		void Finalize(TArray<uint8>& OutDigest)
+		{
+			if (Algorithm == EFileHelperHashAlgorithm::Blake3)
+			{
+				const FBlake3Hash Hash = Blake3.Finalize();
+				OutDigest.Append(Hash.GetBytes(), sizeof(FBlake3Hash::ByteArray));
+			}
+			else
+			{
+				// Big endian so the hex string reads like the canonical XXH128 output
+				const FXxHash128 Hash = XxHash.Finalize();
+				for (const uint64 Part : { Hash.HashHigh, Hash.HashLow })
+				{
+					for (int32 Shift = 56; Shift >= 0; Shift -= 8)
+					{
+						OutDigest.Add(static_cast<uint8>(Part >> Shift));
+					}
+				}
+			}
+		}
+
+	private:
+		EFileHelperHashAlgorithm Algorithm;
+		FBlake3 Blake3;
+		FXxHash128Builder XxHash;
+	};
+
+	/** Hashes a range of a file into its own digest */
+	bool HashFileRange(const FString& InPath, int64 InOffset, int64 InSize, EFileHelperHashAlgorithm InAlgorithm, TArray<uint8>& OutDigest)
+	{
+		TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*InPath));
+		if (!Handle.IsValid() || !Handle->Seek(InOffset))
+		{
+			return false;
+		}
+
+		FHasher Hasher(InAlgorithm);
+		TArray<uint8> Buffer;
+		Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min(ReadSize, FMath::Max<int64>(InSize, 1))));
+		for (int64 Remaining = InSize; Remaining > 0;)
+		{
+			const int64 Size = FMath::Min<int64>(Buffer.Num(), Remaining);
+			if (!Handle->Read(Buffer.GetData(), Size))
+			{
+				return false;
+			}
+			Hasher.Update(Buffer.GetData(), Size);
+			Remaining -= Size;
+		}
+		Hasher.Finalize(OutDigest);
+		return true;
+	}
+
+	/** Root hash over the chunk digests and the total size */
+	FString HashDigests(const TArray<TArray<uint8>>& InDigests, int64 InTotalSize, EFileHelperHashAlgorithm InAlgorithm)
+	{
+		TArray<uint8> Digest;
+		if (InDigests.Num() == 1)
+		{
+			Digest = InDigests[0];
+		}
+		else
+		{
+			FHasher Hasher(InAlgorithm);
+			for (const TArray<uint8>& ChunkDigest : InDigests)
+			{
+				Hasher.Update(ChunkDigest.GetData(), ChunkDigest.Num());
+			}
+			uint8 SizeBytes[sizeof(int64)];
+			for (int32 Index = 0; Index < UE_ARRAY_COUNT(SizeBytes); ++Index)
+			{
+				SizeBytes[Index] = static_cast<uint8>(InTotalSize >> (Index * 8));
+			}
+			Hasher.Update(SizeBytes, sizeof(SizeBytes));
+			Hasher.Finalize(Digest);
+		}
+		return BytesToHex(Digest.GetData(), Digest.Num());
+	}
+
+	int32 GetChunkCount(int64 InSize)
+	{
+		return static_cast<int32>(FMath::Max<int64>(FMath::DivideAndRoundUp(InSize, FFileHelperHash::ChunkSize), 1));
+	}
+}
+
+FString FFileHelperHash::HashBytes(TConstArrayView64<uint8> InBytes, EFileHelperHashAlgorithm InAlgorithm)
+{
+	using namespace FileHelperHash;
+
+	const int64 TotalSize = InBytes.Num();
+	TArray<TArray<uint8>> Digests;
+	Digests.SetNum(GetChunkCount(TotalSize));
+	ParallelFor(Digests.Num(), [&](int32 ChunkIndex)
+	{
+		const int64 Offset = ChunkIndex * ChunkSize;
+		FHasher Hasher(InAlgorithm);
+		Hasher.Update(InBytes.GetData() + Offset, FMath::Min(ChunkSize, TotalSize - Offset));
+		Hasher.Finalize(Digests[ChunkIndex]);
+	});
+	return HashDigests(Digests, TotalSize, InAlgorithm);
+}
+
+bool FFileHelperHash::HashFile(const FString& InPath, EFileHelperHashAlgorithm InAlgorithm, FString& OutHash)
+{
+	using namespace FileHelperHash;
+
+	const int64 TotalSize = FPlatformFileManager::Get().GetPlatformFile().FileSize(*InPath);
+	if (TotalSize < 0)
+	{
+		return false;
+	}
+
+	// Each chunk is streamed with its own handle
+	TArray<TArray<uint8>> Digests;
+	Digests.SetNum(GetChunkCount(TotalSize));
+	std::atomic<bool> bFailed{ false };
+	ParallelFor(Digests.Num(), [&](int32 ChunkIndex)
+	{
+		const int64 Offset = ChunkIndex * ChunkSize;
+		if (!bFailed && !HashFileRange(InPath, Offset, FMath::Min(ChunkSize, TotalSize - Offset), InAlgorithm, Digests[ChunkIndex]))
+		{
+			bFailed = true;
+		}
+	}, EParallelForFlags::Unbalanced);
+
+	if (bFailed)
+	{
+		return false;
+	}
+	OutHash = HashDigests(Digests, TotalSize, InAlgorithm);
+	return true;
+}
+
+bool FFileHelperHash::FingerprintFile(const FString& InPath, FString& OutFingerprint)
+{
+	using namespace FileHelperHash;
+
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	const FFileStatData Stat = FileManager.GetStatData(*InPath);
+	if (!Stat.bIsValid || Stat.bIsDirectory)
+	{
+		return false;
+	}
+
+	TUniquePtr<IFileHandle> Handle(FileManager.OpenRead(*InPath));
+	if (!Handle.IsValid())
+	{
+		return false;
+	}
+
+	FHasher Hasher(EFileHelperHashAlgorithm::XxHash3);
+	int64 Header[2] = { Stat.FileSize, Stat.ModificationTime.GetTicks() };
+	Hasher.Update(Header, sizeof(Header));
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(FingerprintBlockSize);
+	const int64 FirstSize = FMath::Min(FingerprintBlockSize, Stat.FileSize);
+	const int64 LastSize = FMath::Min(FingerprintBlockSize, Stat.FileSize - FirstSize);
+	if (FirstSize > 0)
+	{
+		if (!Handle->Read(Buffer.GetData(), FirstSize))
+		{
+			return false;
+		}
+		Hasher.Update(Buffer.GetData(), FirstSize);
+	}
+	if (LastSize > 0)
+	{
+		if (!Handle->Seek(Stat.FileSize - LastSize) || !Handle->Read(Buffer.GetData(), LastSize))
+		{
+			return false;
+		}
+		Hasher.Update(Buffer.GetData(), LastSize);
+	}
+
+	TArray<uint8> Digest;
+	Hasher.Finalize(Digest);
+	OutFingerprint = BytesToHex(Digest.GetData(), Digest.Num());
+	return true;
+}
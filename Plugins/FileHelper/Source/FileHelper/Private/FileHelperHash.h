@@ -0,0 +1,34 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FileHelperBPLibrary.h"
+
+/**
+ * Content hashing for files and byte arrays,
+ * content up to ChunkSize is hashed directly, larger content is split in chunks hashed in parallel
+ * and the hash is computed over the chunk hashes (tree mode), files are streamed and never fully loaded,
+ * a file and a byte array with the same content get the same hash
+ */
+class FFileHelperHash
+{
+public:
+	/** Size of the chunks hashed in parallel */
+	static constexpr int64 ChunkSize = 4 * 1024 * 1024;
+
+	/** Size of the blocks read at the start and end of a file for a fingerprint */
+	static constexpr int64 FingerprintBlockSize = 64 * 1024;
+
+	/** Hashes a byte array, the hash is returned as an hex string */
+	static FString HashBytes(TConstArrayView64<uint8> InBytes, EFileHelperHashAlgorithm InAlgorithm);
+
+	/** Hashes a file by streaming it */
+	static bool HashFile(const FString& InPath, EFileHelperHashAlgorithm InAlgorithm, FString& OutHash);
+
+	/**
+	 * Cheap change check, hashes the size, the modification time and the first and last blocks of a file,
+	 * it can miss changes in the middle of a file that keep its size and time
+	 */
+	static bool FingerprintFile(const FString& InPath, FString& OutFingerprint);
+};
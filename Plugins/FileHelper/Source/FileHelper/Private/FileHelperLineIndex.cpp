@@ -0,0 +1,270 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperLineIndex.h"
+
+#include "FileHelperLineReader.h"
+#include "FileHelperSIMD.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace FileHelperLineIndex
+{
+	static constexpr uint32 Magic = 0x494C4846; // FHLI
+	static constexpr uint32 Version = 1;
+
+	/** Indexes kept in memory, the least recently used ones are dropped past either limit and read back from their sidecar */
+	static constexpr int32 MaxCachedIndexes = 64;
+	static constexpr int64 MaxCachedBytes = 64 * 1024 * 1024;
+
+	struct FCachedIndex
+	{
+		TSharedPtr<const FFileHelperLineIndex> Index;
+		uint64 LastUse = 0;
+	};
+
+	FCriticalSection CacheLock;
+	TMap<FString, FCachedIndex> Cache;
+	int64 CachedBytes = 0;
+	uint64 UseCounter = 0;
+
+	int64 GetCachedSize(const FFileHelperLineIndex& InIndex)
+	{
+		return static_cast<int64>(InIndex.Num()) * sizeof(int64);
+	}
+
+	/** Cache lock must be held */
+	void RemoveCached(const FString& InKey)
+	{
+		FCachedIndex Removed;
+		if (Cache.RemoveAndCopyValue(InKey, Removed))
+		{
+			CachedBytes -= GetCachedSize(*Removed.Index);
+		}
+	}
+
+	/** Cache lock must be held */
+	void AddCached(const FString& InKey, TSharedPtr<const FFileHelperLineIndex> InIndex)
+	{
+		RemoveCached(InKey);
+		const int64 Size = GetCachedSize(*InIndex);
+		if (Size > MaxCachedBytes)
+		{
+			return;
+		}
+		while (Cache.Num() > 0 && (Cache.Num() >= MaxCachedIndexes || CachedBytes + Size > MaxCachedBytes))
+		{
+			// The cache is small enough for a linear scan
+			const FString* Oldest = nullptr;
+			uint64 OldestUse = MAX_uint64;
+			for (const TPair<FString, FCachedIndex>& Pair : Cache)
+			{
+				if (Pair.Value.LastUse < OldestUse)
+				{
+					OldestUse = Pair.Value.LastUse;
+					Oldest = &Pair.Key;
+				}
+			}
+			RemoveCached(FString(*Oldest));
+		}
+		CachedBytes += Size;
+		Cache.Add(InKey, FCachedIndex{ MoveTemp(InIndex), ++UseCounter });
+	}
+
+	bool GetSourceStat(const FString& InPath, int64& OutFileSize, FDateTime& OutModificationTime)
+	{
+		const FFileStatData Stat = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*InPath);
+		if (!Stat.bIsValid || Stat.bIsDirectory)
+		{
+			return false;
+		}
+		OutFileSize = Stat.FileSize;
+		OutModificationTime = Stat.ModificationTime;
+		return true;
+	}
+
+	FString GetCacheKey(const FString& InPath)
+	{
+		return FPaths::ConvertRelativePathToFull(InPath);
+	}
+}
+
+FString FFileHelperLineIndex::GetIndexPath(const FString& InPath)
+{
+	return InPath + TEXT(".lidx");
+}
+
+bool FFileHelperLineIndex::Build(const FString& InPath)
+{
+	using namespace FileHelperLineIndex;
+
+	TSharedPtr<FFileHelperLineIndex> Index = MakeShared<FFileHelperLineIndex>();
+	if (!GetSourceStat(InPath, Index->FileSize, Index->ModificationTime))
+	{
+		return false;
+	}
+
+	TUniquePtr<IFileHandle> Handle;
+	int64 Offset = 0;
+	if (FFileHelperLineReader::OpenFile(*InPath, Handle, Offset) != FFileHelperLineReader::EResult::Success)
+	{
+		return false;
+	}
+
+	const int64 FileSize = Handle->Size();
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(FFileHelperLineReader::ChunkSize);
+
+	// Whether the last chunk ended in the middle of a line
+	bool bInLine = false;
+	while (Offset < FileSize)
+	{
+		const int64 ReadSize = FMath::Min(FFileHelperLineReader::ChunkSize, FileSize - Offset);
+		if (!Handle->Read(Buffer.GetData(), ReadSize))
+		{
+			return false;
+		}
+
+		const uint8* Start = Buffer.GetData();
+		const uint8* End = Start + ReadSize;
+		const uint8* Cursor = Start;
+		while (Cursor < End)
+		{
+			if (!bInLine)
+			{
+				// Empty lines are not indexed
+				while (Cursor < End && FileHelperSIMD::IsLineBreak(*Cursor))
+				{
+					++Cursor;
+				}
+				if (Cursor == End)
+				{
+					break;
+				}
+				Index->Offsets.Add(Offset + (Cursor - Start));
+				bInLine = true;
+			}
+
+			const uint8* LineEnd = FileHelperSIMD::FindLineBreak(Cursor, End);
+			if (LineEnd == End)
+			{
+				break;
+			}
+			bInLine = false;
+			Cursor = LineEnd + 1;
+		}
+
+		Offset += ReadSize;
+	}
+	Handle.Reset();
+
+	// The in memory index is still usable when the sidecar cannot be written (read only directory)
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	if (Index->Serialize(Writer))
+	{
+		FFileHelper::SaveArrayToFile(Bytes, *GetIndexPath(InPath));
+	}
+
+	FScopeLock Lock(&CacheLock);
+	AddCached(GetCacheKey(InPath), MoveTemp(Index));
+	return true;
+}
+
+TSharedPtr<const FFileHelperLineIndex> FFileHelperLineIndex::Find(const FString& InPath)
+{
+	using namespace FileHelperLineIndex;
+
+	int64 FileSize = 0;
+	FDateTime ModificationTime;
+	if (!GetSourceStat(InPath, FileSize, ModificationTime))
+	{
+		return nullptr;
+	}
+
+	const FString Key = GetCacheKey(InPath);
+	{
+		FScopeLock Lock(&CacheLock);
+		if (FCachedIndex* Cached = Cache.Find(Key))
+		{
+			if (Cached->Index->Matches(FileSize, ModificationTime))
+			{
+				Cached->LastUse = ++UseCounter;
+				return Cached->Index;
+			}
+			RemoveCached(Key);
+		}
+	}
+
+	const FString IndexPath = GetIndexPath(InPath);
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	if (!FileManager.FileExists(*IndexPath))
+	{
+		return nullptr;
+	}
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *IndexPath))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FFileHelperLineIndex> Index = MakeShared<FFileHelperLineIndex>();
+	FMemoryReader Reader(Bytes);
+	if (!Index->Serialize(Reader) || !Index->Matches(FileSize, ModificationTime))
+	{
+		return nullptr;
+	}
+
+	FScopeLock Lock(&CacheLock);
+	AddCached(Key, Index);
+	return Index;
+}
+
+bool FFileHelperLineIndex::Remove(const FString& InPath)
+{
+	using namespace FileHelperLineIndex;
+
+	{
+		FScopeLock Lock(&CacheLock);
+		RemoveCached(GetCacheKey(InPath));
+	}
+
+	const FString IndexPath = GetIndexPath(InPath);
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	return !FileManager.FileExists(*IndexPath) || FileManager.DeleteFile(*IndexPath);
+}
+
+bool FFileHelperLineIndex::Serialize(FArchive& Ar)
+{
+	uint32 FileMagic = FileHelperLineIndex::Magic;
+	uint32 FileVersion = FileHelperLineIndex::Version;
+	int64 ModificationTicks = ModificationTime.GetTicks();
+	int32 LineCount = Offsets.Num();
+
+	Ar << FileMagic;
+	Ar << FileVersion;
+	if (FileMagic != FileHelperLineIndex::Magic || FileVersion != FileHelperLineIndex::Version)
+	{
+		return false;
+	}
+
+	Ar << FileSize;
+	Ar << ModificationTicks;
+	Ar << LineCount;
+	if (Ar.IsError() || LineCount < 0 || (Ar.IsLoading() && LineCount * static_cast<int64>(sizeof(int64)) > Ar.TotalSize() - Ar.Tell()))
+	{
+		return false;
+	}
+
+	if (Ar.IsLoading())
+	{
+		ModificationTime = FDateTime(ModificationTicks);
+		Offsets.SetNumUninitialized(LineCount);
+	}
+	Ar.Serialize(Offsets.GetData(), LineCount * sizeof(int64));
+
+	return !Ar.IsError();
+}
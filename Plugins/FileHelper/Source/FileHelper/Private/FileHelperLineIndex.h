@@ -0,0 +1,54 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Byte offsets of every line of a text file, lines are counted like FFileHelperLineReader (empty lines skipped),
+ * the index is stored in a sidecar file next to the source (<file>.lidx) and the recently used ones are cached in memory,
+ * it is only used while the size and modification time of the source file match
+ */
+class FFileHelperLineIndex
+{
+public:
+	/** Scans the file, saves the sidecar and caches the result, can be called from any thread */
+	static bool Build(const FString& InPath);
+
+	/** Returns the cached or sidecar index of a file when it is still up to date, nullptr otherwise */
+	static TSharedPtr<const FFileHelperLineIndex> Find(const FString& InPath);
+
+	/** Removes the sidecar and the cached index of a file */
+	static bool Remove(const FString& InPath);
+
+	/** Path of the sidecar index file */
+	static FString GetIndexPath(const FString& InPath);
+
+	int32 Num() const
+	{
+		return Offsets.Num();
+	}
+
+	/** Byte offset where a line starts */
+	int64 GetLineOffset(int32 InLine) const
+	{
+		return Offsets[InLine];
+	}
+
+private:
+	bool Serialize(FArchive& Ar);
+
+	bool Matches(int64 InFileSize, const FDateTime& InModificationTime) const
+	{
+		return FileSize == InFileSize && ModificationTime == InModificationTime;
+	}
+
+	/** Size of the source file when indexed */
+	int64 FileSize = 0;
+
+	/** Modification time of the source file when indexed */
+	FDateTime ModificationTime;
+
+	/** Start offset of each line */
+	TArray<int64> Offsets;
+};
@@ -0,0 +1,360 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperLineMatcher.h"
+
+#include "FileHelperSIMD.h"
+#include "Misc/ScopeLock.h"
+
+namespace FileHelperLineMatcher
+{
+	static constexpr int32 MaxCachedPatterns = 64;
+
+	struct FCachedPattern
+	{
+		FRegexPattern Pattern;
+		/** Use counter value of the last lookup, the least recently used pattern is evicted first */
+		uint64 LastUse = 0;
+	};
+
+	FCriticalSection CacheLock;
+	TMap<FString, FCachedPattern> Cache;
+	uint64 UseCounter = 0;
+
+	/** Index of the character closing a group, class or quantifier opened at InIndex, escapes are skipped */
+	int32 FindClosing(const FString& InPattern, int32 InIndex, TCHAR InOpen, TCHAR InClose)
+	{
+		int32 Depth = 0;
+		for (int32 Index = InIndex; Index < InPattern.Len(); ++Index)
+		{
+			const TCHAR Char = InPattern[Index];
+			if (Char == '\\')
+			{
+				++Index;
+			}
+			else if (Char == InOpen)
+			{
+				++Depth;
+				if (InOpen == '[')
+				{
+					// A closing bracket right after the opening one (or its negation) is a literal member of the set
+					if (Index + 1 < InPattern.Len() && InPattern[Index + 1] == '^')
+					{
+						++Index;
+					}
+					if (Index + 1 < InPattern.Len() && InPattern[Index + 1] == ']')
+					{
+						++Index;
+					}
+				}
+			}
+			else if (Char == InClose && --Depth == 0)
+			{
+				return Index;
+			}
+		}
+		return InPattern.Len() - 1;
+	}
+
+	/** Index of the last character of an escape starting with a backslash at InIndex, operands of \x \u \U \0 \c \N \p \P \k and back references included */
+	int32 FindEscapeEnd(const FString& InPattern, int32 InIndex)
+	{
+		const int32 Len = InPattern.Len();
+		int32 Index = InIndex + 1;
+		if (Index >= Len)
+		{
+			return Len - 1;
+		}
+
+		auto SkipDigits = [&InPattern, Len](int32 InFrom, int32 InMax, auto IsDigit)
+		{
+			int32 Last = InFrom - 1;
+			while (Last + 1 < Len && Last + 1 - InFrom < InMax && IsDigit(InPattern[Last + 1]))
+			{
+				++Last;
+			}
+			return Last;
+		};
+		auto IsHex = [](TCHAR Char) { return FChar::IsHexDigit(Char); };
+		auto IsOctal = [](TCHAR Char) { return Char >= '0' && Char <= '7'; };
+		auto IsDecimal = [](TCHAR Char) { return FChar::IsDigit(Char); };
+
+		const TCHAR Escape = InPattern[Index];
+		switch (Escape)
+		{
+		case 'x':
+			if (Index + 1 < Len && InPattern[Index + 1] == '{')
+			{
+				return FindClosing(InPattern, Index + 1, '{', '}');
+			}
+			return SkipDigits(Index + 1, 2, IsHex);
+		case 'u':
+			return SkipDigits(Index + 1, 4, IsHex);
+		case 'U':
+			return SkipDigits(Index + 1, 8, IsHex);
+		case '0':
+			return SkipDigits(Index + 1, 3, IsOctal);
+		case 'c':
+			return FMath::Min(Index + 1, Len - 1);
+		case 'N':
+		case 'p':
+		case 'P':
+			if (Index + 1 < Len && InPattern[Index + 1] == '{')
+			{
+				return FindClosing(InPattern, Index + 1, '{', '}');
+			}
+			// Single letter property (\pL)
+			return FMath::Min(Index + 1, Len - 1);
+		case 'k':
+			if (Index + 1 < Len && InPattern[Index + 1] == '<')
+			{
+				const int32 Close = InPattern.Find(TEXT(">"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index + 1);
+				return Close == INDEX_NONE ? Len - 1 : Close;
+			}
+			return Index;
+		default:
+			if (Escape >= '1' && Escape <= '9')
+			{
+				// Back reference, every following digit belongs to it
+				return SkipDigits(Index + 1, Len, IsDecimal);
+			}
+			return Index;
+		}
+	}
+
+	void ChopLastCodepoint(FString& InOutString)
+	{
+		int32 Count = 1;
+		const int32 Len = InOutString.Len();
+		if (Len > 1 && InOutString[Len - 1] >= 0xDC00 && InOutString[Len - 1] <= 0xDFFF)
+		{
+			// Low surrogate, the code point spans two characters
+			Count = 2;
+		}
+		InOutString.LeftChopInline(FMath::Min(Count, Len));
+	}
+}
+
+FFileHelperLineMatcher::FFileHelperLineMatcher(const FString& InPattern, EFileHelperPatternMode InMode)
+{
+	FString LiteralText;
+	if (InMode == EFileHelperPatternMode::Substring)
+	{
+		LiteralText = InPattern;
+	}
+	else
+	{
+		bool bPureLiteral = false;
+		LiteralText = ExtractRequiredLiteral(InPattern, bPureLiteral);
+		if (!bPureLiteral)
+		{
+			Regex = FindOrCompilePattern(InPattern);
+		}
+	}
+
+	const FTCHARToUTF8 Converted(*LiteralText, LiteralText.Len());
+	Literal.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+}
+
+bool FFileHelperLineMatcher::MatchLine(FUtf8StringView InLine, FString& OutLine) const
+{
+	const uint8* Start = reinterpret_cast<const uint8*>(InLine.GetData());
+	if (Literal.Num() > 0 && !ContainsLiteral(Start, Start + InLine.Len()))
+	{
+		return false;
+	}
+
+	OutLine = FString(InLine.Len(), InLine.GetData());
+	if (!Regex.IsSet())
+	{
+		return true;
+	}
+
+	FRegexMatcher Matcher(Regex.GetValue(), OutLine);
+	return Matcher.FindNext();
+}
+
+bool FFileHelperLineMatcher::MatchLine(const FString& InLine) const
+{
+	if (Literal.Num() > 0)
+	{
+		const FTCHARToUTF8 Converted(*InLine, InLine.Len());
+		const uint8* Start = reinterpret_cast<const uint8*>(Converted.Get());
+		if (!ContainsLiteral(Start, Start + Converted.Length()))
+		{
+			return false;
+		}
+	}
+
+	if (!Regex.IsSet())
+	{
+		return true;
+	}
+
+	FRegexMatcher Matcher(Regex.GetValue(), InLine);
+	return Matcher.FindNext();
+}
+
+void FFileHelperLineMatcher::ClearCache()
+{
+	FScopeLock Lock(&FileHelperLineMatcher::CacheLock);
+	FileHelperLineMatcher::Cache.Reset();
+}
+
+FRegexPattern FFileHelperLineMatcher::FindOrCompilePattern(const FString& InPattern)
+{
+	using namespace FileHelperLineMatcher;
+
+	FScopeLock Lock(&CacheLock);
+	++UseCounter;
+	if (FCachedPattern* Cached = Cache.Find(InPattern))
+	{
+		Cached->LastUse = UseCounter;
+		return Cached->Pattern;
+	}
+	if (Cache.Num() >= MaxCachedPatterns)
+	{
+		// Evict the least recently used pattern, the cache is small enough for a linear scan
+		const FString* Oldest = nullptr;
+		uint64 OldestUse = MAX_uint64;
+		for (const TPair<FString, FCachedPattern>& Pair : Cache)
+		{
+			if (Pair.Value.LastUse < OldestUse)
+			{
+				OldestUse = Pair.Value.LastUse;
+				Oldest = &Pair.Key;
+			}
+		}
+		Cache.Remove(FString(*Oldest));
+	}
+	return Cache.Add(InPattern, FCachedPattern{ FRegexPattern(InPattern), UseCounter }).Pattern;
+}
+
+FString FFileHelperLineMatcher::ExtractRequiredLiteral(const FString& InPattern, bool& bOutPureLiteral)
+{
+	using namespace FileHelperLineMatcher;
+
+	bOutPureLiteral = false;
+
+	// Alternations, inline flags (case insensitive...) and quoting make any literal optional or case dependent
+	if (InPattern.Contains(TEXT("|")) || InPattern.Contains(TEXT("(?")) || InPattern.Contains(TEXT("\\Q")))
+	{
+		return FString();
+	}
+
+	bool bPure = true;
+	FString Best;
+	FString Current;
+	auto EndRun = [&Best, &Current]()
+	{
+		if (Current.Len() > Best.Len())
+		{
+			Best = Current;
+		}
+		Current.Reset();
+	};
+
+	const int32 Len = InPattern.Len();
+	for (int32 Index = 0; Index < Len; ++Index)
+	{
+		const TCHAR Char = InPattern[Index];
+		switch (Char)
+		{
+		case '\\':
+			if (Index + 1 < Len && !FChar::IsAlnum(InPattern[Index + 1]))
+			{
+				// Escaped special character is a literal
+				Current.AppendChar(InPattern[++Index]);
+			}
+			else
+			{
+				// Character class (\d, \w...), anchor (\b...), code point (\x41, \u00e9, \cA...) or back reference,
+				// its operand is skipped so it never ends up in the literal
+				bPure = false;
+				EndRun();
+				Index = FindEscapeEnd(InPattern, Index);
+			}
+			break;
+		case '(':
+			bPure = false;
+			EndRun();
+			Index = FindClosing(InPattern, Index, '(', ')');
+			break;
+		case '[':
+			bPure = false;
+			EndRun();
+			Index = FindClosing(InPattern, Index, '[', ']');
+			break;
+		case '?':
+		case '*':
+		case '{':
+			// Previous atom is optional
+			bPure = false;
+			if (!Current.IsEmpty())
+			{
+				ChopLastCodepoint(Current);
+			}
+			EndRun();
+			if (Char == '{')
+			{
+				Index = FindClosing(InPattern, Index, '{', '}');
+			}
+			if (Index + 1 < Len && (InPattern[Index + 1] == '?' || InPattern[Index + 1] == '+'))
+			{
+				// Lazy or possessive quantifier
+				++Index;
+			}
+			break;
+		case '+':
+			// Previous atom is required at least once
+			bPure = false;
+			EndRun();
+			if (Index + 1 < Len && (InPattern[Index + 1] == '?' || InPattern[Index + 1] == '+'))
+			{
+				++Index;
+			}
+			break;
+		case '.':
+		case '^':
+		case '$':
+		case ')':
+		case ']':
+		case '}':
+			bPure = false;
+			EndRun();
+			break;
+		default:
+			Current.AppendChar(Char);
+			break;
+		}
+	}
+	EndRun();
+
+	bOutPureLiteral = bPure && !Best.IsEmpty();
+	return Best;
+}
+
+bool FFileHelperLineMatcher::ContainsLiteral(const uint8* InStart, const uint8* InEnd) const
+{
+	const int32 Num = Literal.Num();
+	if (InEnd - InStart < Num)
+	{
+		return false;
+	}
+
+	const uint8 First = Literal[0];
+	const uint8* Last = InEnd - Num;
+	while (InStart <= Last)
+	{
+		InStart = FileHelperSIMD::FindByte(InStart, Last + 1, First);
+		if (InStart > Last)
+		{
+			return false;
+		}
+		if (FMemory::Memcmp(InStart, Literal.GetData(), Num) == 0)
+		{
+			return true;
+		}
+		++InStart;
+	}
+	return false;
+}
@@ -0,0 +1,46 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FileHelperBPLibrary.h"
+#include "Internationalization/Regex.h"
+
+/**
+ * Matches text lines against a pattern,
+ * compiled regex patterns are cached across calls and lines are first checked for a literal required by the pattern,
+ * so most lines are rejected on raw UTF-8 bytes before being converted and handed to the regex engine
+ */
+class FFileHelperLineMatcher
+{
+public:
+	FFileHelperLineMatcher(const FString& InPattern, EFileHelperPatternMode InMode);
+
+	/** Matches an UTF-8 line, OutLine holds the converted line when it matches */
+	bool MatchLine(FUtf8StringView InLine, FString& OutLine) const;
+
+	/** Matches an already converted line */
+	bool MatchLine(const FString& InLine) const;
+
+	/** Drops every cached regex pattern */
+	static void ClearCache();
+
+private:
+	/** Returns the compiled pattern from the cache, compiles it on first use */
+	static FRegexPattern FindOrCompilePattern(const FString& InPattern);
+
+	/**
+	 * Finds the longest literal every match of a regex pattern must contain,
+	 * returns an empty string when none can be safely deduced,
+	 * bOutPureLiteral is set when the pattern has no special meaning and is equal to the literal
+	 */
+	static FString ExtractRequiredLiteral(const FString& InPattern, bool& bOutPureLiteral);
+
+	bool ContainsLiteral(const uint8* InStart, const uint8* InEnd) const;
+
+	/** UTF-8 bytes required in a matching line */
+	TArray<uint8> Literal;
+
+	/** Full regex, unset when the literal check is enough */
+	TOptional<FRegexPattern> Regex;
+};
@@ -0,0 +1,182 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperLineReader.h"
+
+#include "FileHelperSIMD.h"
+#include "HAL/PlatformFileManager.h"
+
+namespace FileHelperLineReader
+{
+	using FileHelperSIMD::IsLineBreak;
+	using FileHelperSIMD::FindLineBreak;
+
+	FORCEINLINE FUtf8StringView MakeView(const uint8* InStart, int64 InLength)
+	{
+		return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(InStart), static_cast<int32>(InLength));
+	}
+}
+
+FFileHelperLineReader::EResult FFileHelperLineReader::OpenFile(const TCHAR* InPath, TUniquePtr<IFileHandle>& OutHandle, int64& OutTextStart)
+{
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	OutHandle.Reset(FileManager.OpenRead(InPath));
+	if (!OutHandle.IsValid())
+	{
+		return EResult::NotFound;
+	}
+
+	OutTextStart = 0;
+	uint8 Bom[3] = { 0, 0, 0 };
+	const int64 BomSize = FMath::Min<int64>(OutHandle->Size(), 3);
+	if (BomSize > 0 && !OutHandle->Read(Bom, BomSize))
+	{
+		return EResult::ReadError;
+	}
+
+	if (BomSize >= 2 && ((Bom[0] == 0xFF && Bom[1] == 0xFE) || (Bom[0] == 0xFE && Bom[1] == 0xFF)))
+	{
+		return EResult::UnsupportedEncoding;
+	}
+
+	if (BomSize == 3 && Bom[0] == 0xEF && Bom[1] == 0xBB && Bom[2] == 0xBF)
+	{
+		OutTextStart = 3;
+	}
+
+	return OutHandle->Seek(OutTextStart) ? EResult::Success : EResult::ReadError;
+}
+
+FFileHelperLineReader::EResult FFileHelperLineReader::VisitLines(const TCHAR* InPath, TFunctionRef<bool(FUtf8StringView)> InVisitor, int64 InStartOffset)
+{
+	using namespace FileHelperLineReader;
+
+	TUniquePtr<IFileHandle> Handle;
+	int64 TextStart = 0;
+	const EResult OpenResult = OpenFile(InPath, Handle, TextStart);
+	if (OpenResult != EResult::Success)
+	{
+		return OpenResult;
+	}
+
+	const int64 FileSize = Handle->Size();
+	int64 Offset = FMath::Max(InStartOffset, TextStart);
+	if (Offset >= FileSize)
+	{
+		return EResult::Success;
+	}
+	if (!Handle->Seek(Offset))
+	{
+		return EResult::ReadError;
+	}
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(ChunkSize);
+
+	// Line started in a previous chunk
+	TArray<uint8> Pending;
+
+	while (Offset < FileSize)
+	{
+		const int64 ReadSize = FMath::Min(ChunkSize, FileSize - Offset);
+		if (!Handle->Read(Buffer.GetData(), ReadSize))
+		{
+			return EResult::ReadError;
+		}
+		Offset += ReadSize;
+
+		const uint8* Cursor = Buffer.GetData();
+		const uint8* End = Cursor + ReadSize;
+		while (Cursor < End)
+		{
+			const uint8* LineEnd = FindLineBreak(Cursor, End);
+			if (LineEnd == End)
+			{
+				Pending.Append(Cursor, static_cast<int32>(LineEnd - Cursor));
+				break;
+			}
+
+			if (Pending.Num() > 0)
+			{
+				Pending.Append(Cursor, static_cast<int32>(LineEnd - Cursor));
+				if (!InVisitor(MakeView(Pending.GetData(), Pending.Num())))
+				{
+					return EResult::Success;
+				}
+				Pending.Reset();
+			}
+			else if (LineEnd > Cursor)
+			{
+				if (!InVisitor(MakeView(Cursor, LineEnd - Cursor)))
+				{
+					return EResult::Success;
+				}
+			}
+
+			Cursor = LineEnd + 1;
+		}
+	}
+
+	if (Pending.Num() > 0)
+	{
+		InVisitor(MakeView(Pending.GetData(), Pending.Num()));
+	}
+
+	return EResult::Success;
+}
+
+FFileHelperLineReader::EResult FFileHelperLineReader::FindTailOffset(const TCHAR* InPath, int32 InCount, int64& OutOffset)
+{
+	using namespace FileHelperLineReader;
+
+	TUniquePtr<IFileHandle> Handle;
+	int64 TextStart = 0;
+	const EResult OpenResult = OpenFile(InPath, Handle, TextStart);
+	if (OpenResult != EResult::Success)
+	{
+		return OpenResult;
+	}
+
+	const int64 FileSize = Handle->Size();
+	OutOffset = TextStart;
+	if (InCount <= 0)
+	{
+		OutOffset = FileSize;
+		return EResult::Success;
+	}
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(ChunkSize);
+
+	int32 Found = 0;
+	bool bInLine = false;
+	int64 Position = FileSize;
+	while (Position > TextStart)
+	{
+		const int64 ReadSize = FMath::Min(ChunkSize, Position - TextStart);
+		Position -= ReadSize;
+		if (!Handle->Seek(Position) || !Handle->Read(Buffer.GetData(), ReadSize))
+		{
+			return EResult::ReadError;
+		}
+
+		for (int64 Index = ReadSize - 1; Index >= 0; --Index)
+		{
+			if (!IsLineBreak(Buffer.GetData()[Index]))
+			{
+				bInLine = true;
+			}
+			else if (bInLine)
+			{
+				// Empty lines are not counted
+				bInLine = false;
+				if (++Found == InCount)
+				{
+					OutOffset = Position + Index + 1;
+					return EResult::Success;
+				}
+			}
+		}
+	}
+
+	return EResult::Success;
+}
@@ -0,0 +1,39 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IFileHandle;
+
+/**
+ * Streams the lines of an UTF-8 (or ANSI) text file in bounded chunks,
+ * lines are split on \r\n, \r and \n and empty lines are skipped, like FFileHelper::LoadFileToStringArray,
+ * UTF-16 files are reported as unsupported so callers can fallback to FFileHelper
+ */
+class FFileHelperLineReader
+{
+public:
+	enum class EResult : uint8
+	{
+		Success,
+		NotFound,
+		ReadError,
+		UnsupportedEncoding
+	};
+
+	/** Size of the chunks read from disk */
+	static constexpr int64 ChunkSize = 64 * 1024;
+
+	/**
+	 * Visits the lines of a file in order, starting at a byte offset,
+	 * stops reading as soon as the visitor returns false
+	 */
+	static EResult VisitLines(const TCHAR* InPath, TFunctionRef<bool(FUtf8StringView)> InVisitor, int64 InStartOffset = 0);
+
+	/** Finds the byte offset of the first of the last InCount lines by scanning the file backwards from the end */
+	static EResult FindTailOffset(const TCHAR* InPath, int32 InCount, int64& OutOffset);
+
+	/** Opens the file and detects the encoding, OutTextStart is the offset after the byte order mark */
+	static EResult OpenFile(const TCHAR* InPath, TUniquePtr<IFileHandle>& OutHandle, int64& OutTextStart);
+};
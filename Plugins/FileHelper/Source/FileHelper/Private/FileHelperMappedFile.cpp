@@ -0,0 +1,102 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperMappedFile.h"
+
+#include "HAL/PlatformFileManager.h"
+
+UFileHelperMappedFile* UFileHelperMappedFile::OpenMappedFile(const FString& Path)
+{
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	if (!FileManager.FileExists(*Path))
+	{
+		return nullptr;
+	}
+
+	IPlatformFile::FOpenMappedResult Result = FileManager.OpenMappedEx(*Path);
+	if (Result.HasError())
+	{
+		FFrame::KismetExecutionMessage(TEXT("File cannot be mapped on this platform"), ELogVerbosity::Warning);
+		return nullptr;
+	}
+
+	TUniquePtr<IMappedFileHandle> Handle = Result.StealValue();
+	if (!Handle.IsValid())
+	{
+		return nullptr;
+	}
+
+	// An empty file has nothing to map, the view stays empty
+	TUniquePtr<IMappedFileRegion> Region;
+	if (Handle->GetFileSize() > 0)
+	{
+		Region.Reset(Handle->MapRegion(0, Handle->GetFileSize()));
+		if (!Region.IsValid())
+		{
+			return nullptr;
+		}
+	}
+
+	UFileHelperMappedFile* MappedFile = NewObject<UFileHelperMappedFile>();
+	MappedFile->Path = Path;
+	MappedFile->MappedHandle = MoveTemp(Handle);
+	MappedFile->MappedRegion = MoveTemp(Region);
+	return MappedFile;
+}
+
+bool UFileHelperMappedFile::IsOpen() const
+{
+	return MappedHandle.IsValid();
+}
+
+int64 UFileHelperMappedFile::GetSize() const
+{
+	return MappedRegion.IsValid() ? MappedRegion->GetMappedSize() : 0;
+}
+
+FString UFileHelperMappedFile::GetPath() const
+{
+	return Path;
+}
+
+bool UFileHelperMappedFile::ReadBytes(int64 Offset, int64 Length, TArray<uint8>& Bytes) const
+{
+	Bytes.Reset();
+	if (!IsOpen())
+	{
+		return false;
+	}
+	const TConstArrayView64<uint8> View = GetView();
+	if (Offset < 0 || Length < 0 || Offset > View.Num())
+	{
+		return false;
+	}
+	Length = FMath::Min(Length, View.Num() - Offset);
+	if (Length > MAX_int32)
+	{
+		return false;
+	}
+	Bytes.Append(View.GetData() + Offset, static_cast<int32>(Length));
+	return true;
+}
+
+void UFileHelperMappedFile::Close()
+{
+	// Region must be released before its handle
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+}
+
+TConstArrayView64<uint8> UFileHelperMappedFile::GetView() const
+{
+	if (!MappedRegion.IsValid())
+	{
+		return TConstArrayView64<uint8>();
+	}
+	return TConstArrayView64<uint8>(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize());
+}
+
+void UFileHelperMappedFile::BeginDestroy()
+{
+	Close();
+	Super::BeginDestroy();
+}
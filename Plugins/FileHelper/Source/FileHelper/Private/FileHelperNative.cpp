@@ -0,0 +1,514 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperNative.h"
+
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "FileHelperBPLibrary.h"
+#include "FileHelperCsvCache.h"
+#include "FileHelperCsvTokenizer.h"
+#include "FileHelperCsvValue.h"
+#include "FileHelperUtf8.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/StringBuilder.h"
+
+namespace FileHelperNative
+{
+	/** Size of the output buffer before it is written to disk */
+	static constexpr int32 WriteBufferSize = 64 * 1024;
+
+	/** Quoting is needed when the parser would otherwise split or unescape the cell */
+	bool NeedsQuotes(FStringView InCell)
+	{
+		for (const TCHAR Char : InCell)
+		{
+			if (Char == TEXT(',') || Char == TEXT('"') || Char == TEXT('\r') || Char == TEXT('\n'))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Appends a cell, between quotes with inner quotes doubled when quoted, to an FString or a string builder */
+	template <typename OutputType>
+	void AppendCell(OutputType& Out, FStringView InCell, bool bInQuoteAll)
+	{
+		if (!bInQuoteAll && !NeedsQuotes(InCell))
+		{
+			Out.Append(InCell);
+			return;
+		}
+		Out.AppendChar('"');
+		int32 QuoteIndex = INDEX_NONE;
+		while (InCell.FindChar(TEXT('"'), QuoteIndex))
+		{
+			Out.Append(InCell.Left(QuoteIndex + 1));
+			Out.AppendChar('"');
+			InCell.RightChopInline(QuoteIndex + 1);
+		}
+		Out.Append(InCell);
+		Out.AppendChar('"');
+	}
+
+	/** Appends the header row then the data rows, OnRowEnd is called after each row */
+	template <typename OutputType>
+	void AppendRows(OutputType& Out, TConstArrayView<FString> InHeaders, TConstArrayView<FString> InData, bool bInQuoteAll, TFunctionRef<bool()> InOnRowEnd)
+	{
+		const int32 ColumnCount = InHeaders.Num();
+		const int32 RowCount = 1 + InData.Num() / ColumnCount;
+		for (int32 Row = 0; Row < RowCount; ++Row)
+		{
+			const TConstArrayView<FString> Cells = Row == 0 ? InHeaders : InData.Slice((Row - 1) * ColumnCount, ColumnCount);
+			for (int32 Column = 0; Column < ColumnCount; ++Column)
+			{
+				if (Column > 0)
+				{
+					Out.AppendChar(',');
+				}
+				AppendCell(Out, Cells[Column], bInQuoteAll);
+			}
+			Out.Append(LINE_TERMINATOR);
+			if (!InOnRowEnd())
+			{
+				return;
+			}
+		}
+	}
+
+	/** Filter with its column found in the header and its value read once */
+	struct FQueryFilter
+	{
+		int32 Column = INDEX_NONE;
+		EFileHelperCSVFilterOperator Operator = EFileHelperCSVFilterOperator::Equal;
+		TArray<UTF8CHAR> Value;
+		bool bNumber = false;
+		double Number = 0.0;
+	};
+
+	bool MatchFilter(const FQueryFilter& InFilter, FUtf8StringView InCell)
+	{
+		const FUtf8StringView Value(InFilter.Value.GetData(), InFilter.Value.Num());
+		switch (InFilter.Operator)
+		{
+		case EFileHelperCSVFilterOperator::Contains:
+			return InCell.Find(Value, 0, ESearchCase::CaseSensitive) != INDEX_NONE;
+		case EFileHelperCSVFilterOperator::StartsWith:
+			return InCell.StartsWith(Value, ESearchCase::CaseSensitive);
+		default:
+			break;
+		}
+
+		// Three way comparison, numeric when both sides are numbers
+		int32 Order = 0;
+		double CellNumber = 0.0;
+		if (InFilter.bNumber && FileHelperCsvValue::ParseNumber(InCell, CellNumber))
+		{
+			Order = CellNumber < InFilter.Number ? -1 : (CellNumber > InFilter.Number ? 1 : 0);
+		}
+		else
+		{
+			Order = InCell.Compare(Value, ESearchCase::CaseSensitive);
+		}
+
+		switch (InFilter.Operator)
+		{
+		case EFileHelperCSVFilterOperator::Equal:
+			return Order == 0;
+		case EFileHelperCSVFilterOperator::NotEqual:
+			return Order != 0;
+		case EFileHelperCSVFilterOperator::Less:
+			return Order < 0;
+		case EFileHelperCSVFilterOperator::LessOrEqual:
+			return Order <= 0;
+		case EFileHelperCSVFilterOperator::Greater:
+			return Order > 0;
+		case EFileHelperCSVFilterOperator::GreaterOrEqual:
+			return Order >= 0;
+		default:
+			return false;
+		}
+	}
+
+	/** Runs a query over the rows given by InReadRows to its visitor */
+	bool QueryRows(TFunctionRef<bool(TFunctionRef<bool(TConstArrayView<FUtf8StringView>)>)> InReadRows, TConstArrayView<FString> InColumns, TConstArrayView<FFileHelperCSVFilter> InFilters, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal)
+	{
+		OutTotal = 0;
+		TArray<int32> Selected;
+		TArray<FQueryFilter> Filters;
+		bool bHeader = true;
+		bool bValid = true;
+		const bool bResult = InReadRows([&](TConstArrayView<FUtf8StringView> Row)->bool
+		{
+			if (bHeader)
+			{
+				bHeader = false;
+				TArray<FString> Names;
+				Names.Reserve(Row.Num());
+				for (const FUtf8StringView& Cell : Row)
+				{
+					Names.Emplace(Cell.Len(), Cell.GetData());
+				}
+				auto FindColumn = [&Names](const FString& InName)
+				{
+					return Names.IndexOfByPredicate([&InName](const FString& Name) { return Name.Equals(InName, ESearchCase::CaseSensitive); });
+				};
+
+				if (InColumns.IsEmpty())
+				{
+					for (int32 Column = 0; Column < Names.Num(); ++Column)
+					{
+						Selected.Add(Column);
+					}
+				}
+				for (const FString& Name : InColumns)
+				{
+					Selected.Add(FindColumn(Name));
+				}
+				for (const FFileHelperCSVFilter& Filter : InFilters)
+				{
+					FQueryFilter& Resolved = Filters.AddDefaulted_GetRef();
+					Resolved.Column = FindColumn(Filter.Column);
+					Resolved.Operator = Filter.Operator;
+					Resolved.Value.SetNumUninitialized(FPlatformString::ConvertedLength<UTF8CHAR>(*Filter.Value, Filter.Value.Len()));
+					FPlatformString::Convert(Resolved.Value.GetData(), Resolved.Value.Num(), *Filter.Value, Filter.Value.Len());
+					Resolved.bNumber = FileHelperCsvValue::ParseNumber(FUtf8StringView(Resolved.Value.GetData(), Resolved.Value.Num()), Resolved.Number);
+					bValid &= Resolved.Column != INDEX_NONE;
+				}
+				bValid &= !Selected.Contains(INDEX_NONE);
+				if (!bValid)
+				{
+					return false;
+				}
+
+				for (const int32 Column : Selected)
+				{
+					OutHeaders.Add(Names[Column]);
+				}
+				OutTotal++;
+				return true;
+			}
+
+			// Only the selected cells of matching rows are converted
+			for (const FQueryFilter& Filter : Filters)
+			{
+				if (!MatchFilter(Filter, Filter.Column < Row.Num() ? Row[Filter.Column] : FUtf8StringView()))
+				{
+					return true;
+				}
+			}
+			for (const int32 Column : Selected)
+			{
+				if (Column < Row.Num())
+				{
+					OutData.Emplace(Row[Column].Len(), Row[Column].GetData());
+				}
+				else
+				{
+					OutData.AddDefaulted();
+				}
+			}
+			OutTotal++;
+			return true;
+		});
+		return bResult && bValid;
+	}
+
+	bool IsValidTable(TConstArrayView<FString> InHeaders, TConstArrayView<FString> InData)
+	{
+		return InHeaders.Num() > 0 && InData.Num() % InHeaders.Num() == 0;
+	}
+
+	/** Removes one leading and one trailing quote like FString::TrimQuotes and unescapes doubled quotes */
+	FString UnquoteCell(FStringView InCell)
+	{
+		if (InCell.StartsWith(TEXT('"')))
+		{
+			InCell.RightChopInline(1);
+		}
+		if (InCell.EndsWith(TEXT('"')))
+		{
+			InCell.LeftChopInline(1);
+		}
+		FString Cell(InCell);
+		Cell.ReplaceInline(TEXT("\"\""), TEXT("\""), ESearchCase::CaseSensitive);
+		return Cell;
+	}
+}
+
+bool FFileHelperNative::ReadText(const FString& InPath, FString& OutText)
+{
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	if (FileManager.FileExists(*InPath))
+	{
+		return FFileHelper::LoadFileToString(OutText, *InPath);
+	}
+	return false;
+}
+
+bool FFileHelperNative::SaveText(const FString& InPath, FStringView InText, FString& OutError, bool bInAppend, bool bInForce)
+{
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	FText ErrorFilename;
+	if (!FFileHelper::IsFilenameValidForSaving(InPath, ErrorFilename))
+	{
+		OutError = FString("Filename is not valid");
+		return false;
+	}
+	if (!FileManager.FileExists(*InPath) || bInAppend || bInForce)
+	{
+		return FFileHelper::SaveStringToFile(InText, *InPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), bInAppend ? FILEWRITE_Append : FILEWRITE_None);
+	}
+	else
+	{
+		OutError = FString("File already exists");
+	}
+	return false;
+}
+
+bool FFileHelperNative::ReadCSV(const FString& InPath, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal, bool bInHeaderFirst, bool bInUseCache)
+{
+	OutTotal = 0;
+	IPlatformFile& FileManager = FPlatformFileManager::Get().GetPlatformFile();
+	if (!FileManager.FileExists(*InPath))
+	{
+		return false;
+	}
+	auto AddRow = [&OutHeaders, &OutData, &OutTotal, bInHeaderFirst](TConstArrayView<FUtf8StringView> Row)->bool{
+		OutTotal++;
+		TArray<FString>& Target = (OutTotal == 1 && bInHeaderFirst) ? OutHeaders : OutData;
+		for (const FUtf8StringView& Cell : Row)
+		{
+			Target.Emplace(Cell.Len(), Cell.GetData());
+		}
+		return true;
+	};
+	if (bInUseCache)
+	{
+		return FFileHelperCsvCache::ReadCSV(InPath, AddRow);
+	}
+	// Parse the UTF-8 bytes in chunks, only cells are converted
+	return FFileHelperUtf8::StreamCSV(InPath, AddRow);
+}
+
+bool FFileHelperNative::ReadCSVParallel(const FString& InPath, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal, bool bInHeaderFirst)
+{
+	OutTotal = 0;
+	TArray<uint8> Text;
+	if (!FFileHelperUtf8::LoadFile(InPath, Text))
+	{
+		return false;
+	}
+
+	TArray<const uint8*> Boundaries;
+	FFileHelperCsvTokenizer::SplitRows(Text.GetData(), Text.GetData() + Text.Num(), FTaskGraphInterface::Get().GetNumWorkerThreads() * 4, Boundaries);
+
+	// Cells of each range, and the cell count of each row to find the header
+	struct FRangeRows
+	{
+		TArray<FString> Cells;
+		TArray<int32> RowSizes;
+	};
+	TArray<FRangeRows> Ranges;
+	Ranges.SetNum(Boundaries.Num() - 1);
+	ParallelFor(Ranges.Num(), [&](int32 Range)
+	{
+		FRangeRows& Rows = Ranges[Range];
+		FFileHelperCsvTokenizer Tokenizer(const_cast<uint8*>(Boundaries[Range]), const_cast<uint8*>(Boundaries[Range + 1]));
+		TArray<FUtf8StringView> Cells;
+		while (Tokenizer.ParseRow(Cells))
+		{
+			Rows.RowSizes.Add(Cells.Num());
+			for (const FUtf8StringView& Cell : Cells)
+			{
+				Rows.Cells.Emplace(Cell.Len(), Cell.GetData());
+			}
+		}
+	}, EParallelForFlags::Unbalanced);
+	Text.Empty();
+
+	int32 CellCount = 0;
+	for (const FRangeRows& Rows : Ranges)
+	{
+		OutTotal += Rows.RowSizes.Num();
+		CellCount += Rows.Cells.Num();
+	}
+	OutData.Reserve(OutData.Num() + CellCount);
+
+	bool bHeaderPending = bInHeaderFirst;
+	for (FRangeRows& Rows : Ranges)
+	{
+		int32 FirstDataCell = 0;
+		if (bHeaderPending && Rows.RowSizes.Num() > 0)
+		{
+			// Header is the first row of the first non empty range
+			FirstDataCell = Rows.RowSizes[0];
+			for (int32 Cell = 0; Cell < FirstDataCell; ++Cell)
+			{
+				OutHeaders.Add(MoveTemp(Rows.Cells[Cell]));
+			}
+			bHeaderPending = false;
+		}
+		for (int32 Cell = FirstDataCell; Cell < Rows.Cells.Num(); ++Cell)
+		{
+			OutData.Add(MoveTemp(Rows.Cells[Cell]));
+		}
+	}
+	return true;
+}
+
+bool FFileHelperNative::QueryCSV(const FString& InPath, TConstArrayView<FString> InColumns, TConstArrayView<FFileHelperCSVFilter> InFilters, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal)
+{
+	return FileHelperNative::QueryRows([&InPath](TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor)->bool
+	{
+		return FFileHelperUtf8::StreamCSV(InPath, InRowVisitor);
+	}, InColumns, InFilters, OutHeaders, OutData, OutTotal);
+}
+
+bool FFileHelperNative::SaveCSV(const FString& InPath, TConstArrayView<FString> InHeaders, TConstArrayView<FString> InData, int32& OutTotal, bool bInForce, bool bInQuoteAll)
+{
+	using namespace FileHelperNative;
+
+	OutTotal = 0;
+	if (!IsValidTable(InHeaders, InData))
+	{
+		return false;
+	}
+	FText ErrorFilename;
+	if (!FFileHelper::IsFilenameValidForSaving(InPath, ErrorFilename))
+	{
+		return false;
+	}
+	if (!bInForce && FPlatformFileManager::Get().GetPlatformFile().FileExists(*InPath))
+	{
+		return false;
+	}
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*InPath));
+	if (!Writer.IsValid())
+	{
+		return false;
+	}
+
+	// Rows are encoded to UTF-8 in a bounded buffer written to disk as it fills up
+	TUtf8StringBuilder<1024> Buffer;
+	auto Flush = [&Buffer, &Writer]()
+	{
+		Writer->Serialize(const_cast<UTF8CHAR*>(Buffer.GetData()), Buffer.Len());
+		Buffer.Reset();
+	};
+	AppendRows(Buffer, InHeaders, InData, bInQuoteAll, [&]()->bool
+	{
+		if (Buffer.Len() >= WriteBufferSize)
+		{
+			Flush();
+		}
+		return !Writer->IsError();
+	});
+	Flush();
+
+	if (!Writer->Close())
+	{
+		return false;
+	}
+	OutTotal = (InData.Num() / InHeaders.Num()) + 1;
+	return true;
+}
+
+bool FFileHelperNative::StringToCSV(FStringView InContent, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal, bool bInHeaderFirst)
+{
+	FFileHelperUtf8::ParseCSV(InContent, [&OutHeaders, &OutData, &OutTotal, bInHeaderFirst](TConstArrayView<FUtf8StringView> Row)->bool{
+		OutTotal++;
+		TArray<FString>& Target = (OutTotal == 1 && bInHeaderFirst) ? OutHeaders : OutData;
+		for (const FUtf8StringView& Cell : Row)
+		{
+			Target.Emplace(Cell.Len(), Cell.GetData());
+		}
+		return true;
+	});
+	return true;
+}
+
+bool FFileHelperNative::StringToCSVQuery(FStringView InContent, TConstArrayView<FString> InColumns, TConstArrayView<FFileHelperCSVFilter> InFilters, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal)
+{
+	return FileHelperNative::QueryRows([InContent](TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor)->bool
+	{
+		FFileHelperUtf8::ParseCSV(InContent, InRowVisitor);
+		return true;
+	}, InColumns, InFilters, OutHeaders, OutData, OutTotal);
+}
+
+bool FFileHelperNative::CSVToString(FString& OutResult, TConstArrayView<FString> InHeaders, TConstArrayView<FString> InData, int32& OutTotal, bool bInQuoteAll)
+{
+	using namespace FileHelperNative;
+
+	OutTotal = 0;
+	if (!IsValidTable(InHeaders, InData))
+	{
+		return false;
+	}
+
+	// Cells, quotes and delimiters, only doubled quotes can grow the output past it
+	const int32 RowCount = (InData.Num() / InHeaders.Num()) + 1;
+	int64 Estimate = static_cast<int64>(RowCount) * FCString::Strlen(LINE_TERMINATOR);
+	for (const TConstArrayView<FString>& Cells : { InHeaders, InData })
+	{
+		for (const FString& Cell : Cells)
+		{
+			Estimate += Cell.Len() + 3;
+		}
+	}
+	OutResult.Reserve(static_cast<int32>(FMath::Min<int64>(OutResult.Len() + Estimate, MAX_int32)));
+
+	AppendRows(OutResult, InHeaders, InData, bInQuoteAll, []()->bool
+	{
+		return true;
+	});
+
+	OutTotal = RowCount;
+	return true;
+}
+
+void FFileHelperNative::AppendCSVRow(FString& OutResult, TConstArrayView<FString> InCells, bool bInQuoteAll)
+{
+	using namespace FileHelperNative;
+
+	for (int32 Column = 0; Column < InCells.Num(); ++Column)
+	{
+		if (Column > 0)
+		{
+			OutResult.AppendChar(TEXT(','));
+		}
+		AppendCell(OutResult, InCells[Column], bInQuoteAll);
+	}
+	OutResult.Append(LINE_TERMINATOR);
+}
+
+bool FFileHelperNative::StringArrayToCSV(TConstArrayView<FString> InLines, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal, FStringView InDelimiter, bool bInHeaderFirst)
+{
+	using namespace FileHelperNative;
+
+	FString Separator(TEXT("\""));
+	Separator.Append(InDelimiter);
+	Separator.AppendChar(TEXT('"'));
+	for (const FString& Line : InLines)
+	{
+		OutTotal++;
+		int32 SeparatorIndex = Line.Find(Separator, ESearchCase::CaseSensitive);
+		if (SeparatorIndex == INDEX_NONE)
+		{
+			continue;
+		}
+		TArray<FString>& Target = (OutTotal == 1 && bInHeaderFirst) ? OutHeaders : OutData;
+		FStringView Remaining(Line);
+		while (SeparatorIndex != INDEX_NONE)
+		{
+			Target.Add(UnquoteCell(Remaining.Left(SeparatorIndex)));
+			Remaining.RightChopInline(SeparatorIndex + Separator.Len());
+			SeparatorIndex = Remaining.Find(Separator, 0, ESearchCase::CaseSensitive);
+		}
+		Target.Add(UnquoteCell(Remaining));
+	}
+	return true;
+}
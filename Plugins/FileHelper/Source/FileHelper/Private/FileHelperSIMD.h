@@ -0,0 +1,125 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// vmaxvq_u8 and vpaddq_u8 only exist on AArch64, 32 bits ARM uses the scalar loops
+#define FILEHELPER_SIMD_NEON (PLATFORM_ENABLE_VECTORINTRINSICS_NEON && PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS)
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#elif FILEHELPER_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+/** Vectorized byte scanning used by the text and csv readers, 16 or 64 bytes are compared per step */
+namespace FileHelperSIMD
+{
+	FORCEINLINE const uint8* FindEitherByteScalar(const uint8* InStart, const uint8* InEnd, uint8 InA, uint8 InB)
+	{
+		while (InStart < InEnd && *InStart != InA && *InStart != InB)
+		{
+			++InStart;
+		}
+		return InStart;
+	}
+
+	/** Returns the first position in [InStart, InEnd) holding InA or InB, InEnd when not found */
+	FORCEINLINE const uint8* FindEitherByte(const uint8* InStart, const uint8* InEnd, uint8 InA, uint8 InB)
+	{
+#if PLATFORM_CPU_X86_FAMILY
+		const __m128i A = _mm_set1_epi8(static_cast<char>(InA));
+		const __m128i B = _mm_set1_epi8(static_cast<char>(InB));
+		while (InEnd - InStart >= 16)
+		{
+			const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(InStart));
+			const uint32 Mask = static_cast<uint32>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(Chunk, A), _mm_cmpeq_epi8(Chunk, B))));
+			if (Mask != 0)
+			{
+				return InStart + FMath::CountTrailingZeros(Mask);
+			}
+			InStart += 16;
+		}
+#elif FILEHELPER_SIMD_NEON
+		const uint8x16_t A = vdupq_n_u8(InA);
+		const uint8x16_t B = vdupq_n_u8(InB);
+		while (InEnd - InStart >= 16)
+		{
+			const uint8x16_t Chunk = vld1q_u8(InStart);
+			if (vmaxvq_u8(vorrq_u8(vceqq_u8(Chunk, A), vceqq_u8(Chunk, B))) != 0)
+			{
+				// Match is in this block, let the scalar loop locate it
+				break;
+			}
+			InStart += 16;
+		}
+#endif
+		return FindEitherByteScalar(InStart, InEnd, InA, InB);
+	}
+
+	/** Returns the first position in [InStart, InEnd) holding InByte, InEnd when not found */
+	FORCEINLINE const uint8* FindByte(const uint8* InStart, const uint8* InEnd, uint8 InByte)
+	{
+		return FindEitherByte(InStart, InEnd, InByte, InByte);
+	}
+
+	/** Returns the first \r or \n in [InStart, InEnd), InEnd when not found */
+	FORCEINLINE const uint8* FindLineBreak(const uint8* InStart, const uint8* InEnd)
+	{
+		return FindEitherByte(InStart, InEnd, '\r', '\n');
+	}
+
+	/** Bit i of the result is set when InStart[i] is one of the four bytes, 64 bytes are read */
+	FORCEINLINE uint64 FindAnyOf4Mask64(const uint8* InStart, uint8 InA, uint8 InB, uint8 InC, uint8 InD)
+	{
+#if PLATFORM_CPU_X86_FAMILY
+		const __m128i A = _mm_set1_epi8(static_cast<char>(InA));
+		const __m128i B = _mm_set1_epi8(static_cast<char>(InB));
+		const __m128i C = _mm_set1_epi8(static_cast<char>(InC));
+		const __m128i D = _mm_set1_epi8(static_cast<char>(InD));
+		uint64 Mask = 0;
+		for (int32 Block = 0; Block < 4; ++Block)
+		{
+			const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(InStart + Block * 16));
+			const __m128i Match = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(Chunk, A), _mm_cmpeq_epi8(Chunk, B)), _mm_or_si128(_mm_cmpeq_epi8(Chunk, C), _mm_cmpeq_epi8(Chunk, D)));
+			Mask |= static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(Match))) << (Block * 16);
+		}
+		return Mask;
+#elif FILEHELPER_SIMD_NEON
+		const uint8x16_t A = vdupq_n_u8(InA);
+		const uint8x16_t B = vdupq_n_u8(InB);
+		const uint8x16_t C = vdupq_n_u8(InC);
+		const uint8x16_t D = vdupq_n_u8(InD);
+		static const uint8 BitWeights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+		const uint8x16_t Weights = vld1q_u8(BitWeights);
+		uint8x16_t Blocks[4];
+		for (int32 Block = 0; Block < 4; ++Block)
+		{
+			const uint8x16_t Chunk = vld1q_u8(InStart + Block * 16);
+			const uint8x16_t Match = vorrq_u8(vorrq_u8(vceqq_u8(Chunk, A), vceqq_u8(Chunk, B)), vorrq_u8(vceqq_u8(Chunk, C), vceqq_u8(Chunk, D)));
+			Blocks[Block] = vandq_u8(Match, Weights);
+		}
+		// Pairwise sums fold each group of 8 weighted bytes into one byte of the mask
+		uint8x16_t Sum = vpaddq_u8(vpaddq_u8(Blocks[0], Blocks[1]), vpaddq_u8(Blocks[2], Blocks[3]));
+		Sum = vpaddq_u8(Sum, Sum);
+		return vgetq_lane_u64(vreinterpretq_u64_u8(Sum), 0);
+#else
+		uint64 Mask = 0;
+		for (int32 Index = 0; Index < 64; ++Index)
+		{
+			const uint8 Byte = InStart[Index];
+			if (Byte == InA || Byte == InB || Byte == InC || Byte == InD)
+			{
+				Mask |= uint64(1) << Index;
+			}
+		}
+		return Mask;
+#endif
+	}
+
+	FORCEINLINE bool IsLineBreak(uint8 InChar)
+	{
+		return InChar == '\r' || InChar == '\n';
+	}
+}
@@ -0,0 +1,150 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperSearchAction.h"
+
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "FileHelperLineMatcher.h"
+#include "FileHelperUtf8.h"
+#include "Misc/Paths.h"
+
+UFileHelperSearchFilesAction* UFileHelperSearchFilesAction::SearchFilesAsync(const FString& Directory, const FString& Pattern, EFileHelperPatternMode Mode, const FString& FilePattern, bool Recursive, int32 MaxResults)
+{
+	UFileHelperSearchFilesAction* Node = NewObject<UFileHelperSearchFilesAction>();
+	Node->Directory = Directory;
+	Node->Pattern = Pattern;
+	Node->PatternMode = Mode;
+	Node->FilePattern = FilePattern;
+	Node->bRecursive = Recursive;
+	Node->MaxResults = MaxResults;
+	Node->bActive = false;
+	return Node;
+}
+
+void UFileHelperSearchFilesAction::Cancel()
+{
+	if (CancelFlag.IsValid())
+	{
+		*CancelFlag = true;
+	}
+}
+
+void UFileHelperSearchFilesAction::Activate()
+{
+	if (bActive)
+	{
+		FFrame::KismetExecutionMessage(TEXT("SearchFilesAction is already running"), ELogVerbosity::Warning);
+		Failed.Broadcast(TArray<FFileHelperSearchMatch>());
+		return;
+	}
+
+	bActive = true;
+	CancelFlag = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+
+	TWeakObjectPtr<UFileHelperSearchFilesAction> ThisWeak(this);
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [ThisWeak, InCancelFlag = CancelFlag, InDirectory = MoveTemp(Directory), InPattern = MoveTemp(Pattern), InFilePattern = MoveTemp(FilePattern), InPatternMode = PatternMode, bInRecursive = bRecursive, InMaxResults = MaxResults]()
+	{
+		TArray<FString> Files;
+		if (!UFileHelperBPLibrary::ListDirectory(InDirectory, InFilePattern, Files, /** ShowFile */true, /** ShowDirectory */false, bInRecursive))
+		{
+			AsyncTask(ENamedThreads::Type::GameThread, [ThisWeak]()
+			{
+				if (UFileHelperSearchFilesAction* This = ThisWeak.Get())
+				{
+					This->OnTaskCompleted(false, {});
+				}
+			});
+			return;
+		}
+
+		const FFileHelperLineMatcher Matcher(InPattern, InPatternMode);
+		const int32 Cap = InMaxResults > 0 ? InMaxResults : MAX_int32;
+		std::atomic<int32> MatchCount{ 0 };
+
+		// Files are matched concurrently, results are kept per file to return them in listing order
+		TArray<TArray<FFileHelperSearchMatch>> FileMatches;
+		FileMatches.SetNum(Files.Num());
+
+		ParallelFor(Files.Num(), [&](int32 FileIndex)
+		{
+			if (*InCancelFlag || MatchCount >= Cap)
+			{
+				return;
+			}
+
+			TArray<FFileHelperSearchMatch>& Matches = FileMatches[FileIndex];
+			int32 LineIndex = 0;
+			FString MatchedLine;
+			FFileHelperUtf8::VisitLines(FPaths::Combine(InDirectory, Files[FileIndex]), [&](FUtf8StringView Line)->bool
+			{
+				if (*InCancelFlag)
+				{
+					return false;
+				}
+				if (Matcher.MatchLine(Line, MatchedLine))
+				{
+					// Reserve a slot before adding so the cap holds across workers
+					if (MatchCount.fetch_add(1) >= Cap)
+					{
+						return false;
+					}
+					FFileHelperSearchMatch& Match = Matches.AddDefaulted_GetRef();
+					Match.Path = Files[FileIndex];
+					Match.LineIndex = LineIndex;
+					Match.Line = MoveTemp(MatchedLine);
+				}
+				LineIndex++;
+				return true;
+			});
+
+			if (Matches.Num() > 0)
+			{
+				AsyncTask(ENamedThreads::Type::GameThread, [ThisWeak, Matches]()
+				{
+					UFileHelperSearchFilesAction* This = ThisWeak.Get();
+					if (This && This->bActive)
+					{
+						This->Found.Broadcast(Matches);
+					}
+				});
+			}
+		}, EParallelForFlags::Unbalanced | EParallelForFlags::BackgroundPriority);
+
+		TArray<FFileHelperSearchMatch> AllMatches;
+		for (TArray<FFileHelperSearchMatch>& Matches : FileMatches)
+		{
+			AllMatches.Append(MoveTemp(Matches));
+		}
+
+		AsyncTask(ENamedThreads::Type::GameThread, [ThisWeak, bResult = !*InCancelFlag, AllMatches = MoveTemp(AllMatches)]() mutable
+		{
+			if (UFileHelperSearchFilesAction* This = ThisWeak.Get())
+			{
+				This->OnTaskCompleted(bResult, MoveTemp(AllMatches));
+			}
+		});
+	});
+}
+
+void UFileHelperSearchFilesAction::OnTaskCompleted(bool bInSuccess, TArray<FFileHelperSearchMatch>&& InMatches)
+{
+	Reset();
+
+	if (bInSuccess)
+	{
+		Completed.Broadcast(InMatches);
+	}
+	else
+	{
+		Failed.Broadcast(InMatches);
+	}
+}
+
+void UFileHelperSearchFilesAction::Reset()
+{
+	bActive = false;
+	CancelFlag.Reset();
+	Directory.Empty();
+	Pattern.Empty();
+	FilePattern.Empty();
+}
@@ -0,0 +1,204 @@
+// Copyright 2025 RLoris
+
+#include "FileHelperUtf8.h"
+
+#include "FileHelperCsvTokenizer.h"
+#include "FileHelperLineReader.h"
+#include "FileHelperSIMD.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+namespace FileHelperUtf8
+{
+	/** Reads the raw file bytes, then strips the UTF-8 byte order mark or converts UTF-16 text to UTF-8 */
+	template <typename CharType>
+	bool LoadUtf8(const FString& InPath, TArray<CharType>& OutText)
+	{
+		static_assert(sizeof(CharType) == 1, "UTF-8 buffer expected");
+
+		OutText.Reset();
+		TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*InPath));
+		if (!Reader.IsValid())
+		{
+			return false;
+		}
+		const int64 Size = Reader->TotalSize();
+		if (Size >= MAX_int32)
+		{
+			return false;
+		}
+		OutText.SetNumUninitialized(static_cast<int32>(Size));
+		Reader->Serialize(OutText.GetData(), Size);
+		if (!Reader->Close())
+		{
+			OutText.Reset();
+			return false;
+		}
+
+		const uint8* Bytes = reinterpret_cast<const uint8*>(OutText.GetData());
+		if (Size >= 2 && ((Bytes[0] == 0xFF && Bytes[1] == 0xFE) || (Bytes[0] == 0xFE && Bytes[1] == 0xFF)))
+		{
+			FString Wide;
+			FFileHelper::BufferToString(Wide, Bytes, static_cast<int32>(Size));
+			const FTCHARToUTF8 Converted(*Wide, Wide.Len());
+			OutText.SetNumUninitialized(Converted.Length());
+			FMemory::Memcpy(OutText.GetData(), Converted.Get(), Converted.Length());
+		}
+		else if (Size >= 3 && Bytes[0] == 0xEF && Bytes[1] == 0xBB && Bytes[2] == 0xBF)
+		{
+			OutText.RemoveAt(0, 3, EAllowShrinking::No);
+		}
+		return true;
+	}
+}
+
+bool FFileHelperUtf8::LoadFile(const FString& InPath, TArray<uint8>& OutText)
+{
+	return FileHelperUtf8::LoadUtf8(InPath, OutText);
+}
+
+bool FFileHelperUtf8::ReadText(const FString& InPath, FUtf8String& OutText)
+{
+	// Load straight into the string storage to avoid another copy
+	TArray<UTF8CHAR>& Chars = OutText.GetCharArray();
+	if (!FileHelperUtf8::LoadUtf8(InPath, Chars))
+	{
+		return false;
+	}
+	if (!Chars.IsEmpty())
+	{
+		Chars.Add(UTF8CHAR('\0'));
+	}
+	return true;
+}
+
+bool FFileHelperUtf8::VisitLines(const FString& InPath, TFunctionRef<bool(FUtf8StringView)> InVisitor)
+{
+	const FFileHelperLineReader::EResult Result = FFileHelperLineReader::VisitLines(*InPath, InVisitor);
+	if (Result != FFileHelperLineReader::EResult::UnsupportedEncoding)
+	{
+		return Result == FFileHelperLineReader::EResult::Success;
+	}
+
+	// UTF-16 files are converted in memory
+	TArray<uint8> Text;
+	if (!LoadFile(InPath, Text))
+	{
+		return false;
+	}
+	const uint8* Cursor = Text.GetData();
+	const uint8* End = Cursor + Text.Num();
+	while (Cursor < End)
+	{
+		const uint8* LineEnd = FileHelperSIMD::FindLineBreak(Cursor, End);
+		if (LineEnd != Cursor && !InVisitor(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Cursor), static_cast<int32>(LineEnd - Cursor))))
+		{
+			break;
+		}
+		if (LineEnd >= End)
+		{
+			break;
+		}
+		Cursor = LineEnd + 1;
+	}
+	return true;
+}
+
+void FFileHelperUtf8::ParseCSV(TArrayView<uint8> InOutText, TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor)
+{
+	FFileHelperCsvTokenizer Tokenizer(InOutText.GetData(), InOutText.GetData() + InOutText.Num());
+	TArray<FUtf8StringView> Cells;
+	while (Tokenizer.ParseRow(Cells))
+	{
+		if (!InRowVisitor(Cells))
+		{
+			break;
+		}
+	}
+}
+
+void FFileHelperUtf8::ParseCSV(FStringView InText, TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor)
+{
+	TArray<uint8> Text;
+	Text.SetNumUninitialized(FPlatformString::ConvertedLength<UTF8CHAR>(InText.GetData(), InText.Len()));
+	FPlatformString::Convert(reinterpret_cast<UTF8CHAR*>(Text.GetData()), Text.Num(), InText.GetData(), InText.Len());
+	ParseCSV(Text, InRowVisitor);
+}
+
+bool FFileHelperUtf8::ReadCSV(const FString& InPath, TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor)
+{
+	TArray<uint8> Text;
+	if (!LoadFile(InPath, Text))
+	{
+		return false;
+	}
+	ParseCSV(Text, InRowVisitor);
+	return true;
+}
+
+bool FFileHelperUtf8::StreamCSV(const FString& InPath, TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor, int32 InChunkSize)
+{
+	TUniquePtr<IFileHandle> Handle;
+	int64 TextStart = 0;
+	const FFileHelperLineReader::EResult OpenResult = FFileHelperLineReader::OpenFile(*InPath, Handle, TextStart);
+	if (OpenResult == FFileHelperLineReader::EResult::UnsupportedEncoding)
+	{
+		// UTF-16 files are converted in memory
+		return ReadCSV(InPath, InRowVisitor);
+	}
+	if (OpenResult != FFileHelperLineReader::EResult::Success)
+	{
+		return false;
+	}
+
+	const int64 FileSize = Handle->Size();
+	const int64 ChunkSize = FMath::Max(InChunkSize, 1);
+	int64 Offset = TextStart;
+
+	// Bytes of the incomplete row kept at the front of the buffer
+	int64 Pending = 0;
+	TArray<uint8> Buffer;
+	TArray<FUtf8StringView> Cells;
+	while (true)
+	{
+		// Reads grow with the pending row so a long row is not rescanned for every chunk
+		const int64 ReadSize = FMath::Min(FMath::Max(ChunkSize, Pending), FileSize - Offset);
+		const bool bLastChunk = Offset + ReadSize >= FileSize;
+		if (Pending + ReadSize >= MAX_int32)
+		{
+			return false;
+		}
+		Buffer.SetNumUninitialized(static_cast<int32>(Pending + ReadSize), EAllowShrinking::No);
+		if (ReadSize > 0 && !Handle->Read(Buffer.GetData() + Pending, ReadSize))
+		{
+			return false;
+		}
+		Offset += ReadSize;
+
+		uint8* Start = Buffer.GetData();
+		uint8* End = Start + Buffer.Num();
+		uint8* RowsEnd = const_cast<uint8*>(FFileHelperCsvTokenizer::FindRowsEnd(Start, End, bLastChunk));
+
+		// An empty file still gives the single empty row of ReadCSV
+		if (RowsEnd > Start || FileSize == TextStart)
+		{
+			FFileHelperCsvTokenizer Tokenizer(Start, RowsEnd);
+			while (Tokenizer.ParseRow(Cells))
+			{
+				if (!InRowVisitor(Cells))
+				{
+					return true;
+				}
+			}
+		}
+
+		if (bLastChunk)
+		{
+			return true;
+		}
+
+		Pending = End - RowsEnd;
+		FMemory::Memmove(Start, RowsEnd, Pending);
+	}
+}
@@ -7,7 +7,67 @@
 #include "FileHelperBPLibrary.generated.h"
 
 class FConfigFile;
+class FFileHelperExportPlan;
 class UDataTable;
+struct FFileHelperExportField;
+
+UENUM(BlueprintType)
+enum class EFileHelperPatternMode : uint8
+{
+	/** Pattern is a regular expression */
+	Regex,
+	/** Pattern is a plain case sensitive substring, no regex is involved */
+	Substring
+};
+
+UENUM(BlueprintType)
+enum class EFileHelperCompressionCodec : uint8
+{
+	Oodle,
+	Zlib,
+	LZ4
+};
+
+UENUM(BlueprintType)
+enum class EFileHelperHashAlgorithm : uint8
+{
+	/** 128 bits XXH3, fastest */
+	XxHash3,
+	/** 256 bits BLAKE3, cryptographic */
+	Blake3
+};
+
+UENUM(BlueprintType)
+enum class EFileHelperCSVFilterOperator : uint8
+{
+	Equal,
+	NotEqual,
+	Less,
+	LessOrEqual,
+	Greater,
+	GreaterOrEqual,
+	/** Cell contains the value, case sensitive */
+	Contains,
+	/** Cell starts with the value, case sensitive */
+	StartsWith
+};
+
+/** Condition on a csv column, numbers are compared as numbers when the cell and the value are both numbers, text is compared case sensitively otherwise */
+USTRUCT(BlueprintType)
+struct FFileHelperCSVFilter
+{
+	GENERATED_BODY()
+
+	/** Header of the column to test */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FileHelper|CSV")
+	FString Column;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FileHelper|CSV")
+	EFileHelperCSVFilterOperator Operator = EFileHelperCSVFilterOperator::Equal;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FileHelper|CSV")
+	FString Value;
+};
 
 USTRUCT(BlueprintType)
 struct FCustomNodeStat
@@ -132,45 +192,83 @@ public:
 
 	/* File */
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "ReadTextFile", CompactNodeTitle = "ReadText", Keywords = "File plugin read text", ToolTip = "Read a standard text file"), Category = "FileHelper|File|Text")
-	static bool ReadText(FString Path, FString& Output);
+	static bool ReadText(const FString& Path, FString& Output);
 
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "WriteTextFile", CompactNodeTitle = "WriteText", Keywords = "File plugin write text", ToolTip = "Save a standard text file"), Category = "FileHelper|File|Text")
-	static bool SaveText(FString Path, FString Text, FString& Error, bool Append = false, bool Force = false);
+	static bool SaveText(const FString& Path, const FString& Text, FString& Error, bool Append = false, bool Force = false);
 
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "ReadLineFile", CompactNodeTitle = "ReadLine", Keywords = "File plugin read text lines pattern", ToolTip = "Read the lines of a standard text file"), Category = "FileHelper|File|Text")
-	static bool ReadLine(FString Path, FString Pattern, TArray<FString>& Lines);
+	static bool ReadLine(FString Path, FString Pattern, TArray<FString>& Lines, EFileHelperPatternMode Mode = EFileHelperPatternMode::Regex);
 
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "ReadLineRangeFile", CompactNodeTitle = "ReadLineRange", Keywords = "File plugin read text lines range", ToolTip = "Read range of lines of a standard text file"), Category = "FileHelper|File|Text")
 	static bool ReadLineRange(FString InPath, TArray<FString>& OutLines, int32 InStartIdx = 0, int32 InEndIdx = -1);
 
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "ReadLineTailFile", CompactNodeTitle = "ReadLineTail", Keywords = "File plugin read text lines tail last", ToolTip = "Read the last lines of a standard text file"), Category = "FileHelper|File|Text")
+	static bool ReadLineTail(FString InPath, TArray<FString>& OutLines, int32 InCount = 10);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "BuildLineIndex", Keywords = "File plugin text lines index", ToolTip = "Builds a sidecar line index used by ReadLineRange to seek directly to the first line, invalidated when the file changes"), Category = "FileHelper|File|Text")
+	static bool BuildLineIndex(FString InPath);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "RemoveLineIndex", Keywords = "File plugin text lines index", ToolTip = "Removes the sidecar line index of a file"), Category = "FileHelper|File|Text")
+	static bool RemoveLineIndex(FString InPath);
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "WriteLineFile", CompactNodeTitle = "WriteLine", Keywords = "File plugin write text lines", ToolTip = "Save lines in a standard text file"), Category = "FileHelper|File|Text")
 	static bool SaveLine(FString Path, const TArray<FString>& Text, FString& Error, bool Append = false, bool Force = false);
 
-	UFUNCTION(BlueprintCallable, meta = (DisplayName = "ReadByteFile", CompactNodeTitle = "ReadByte", Keywords = "File plugin read byte", ToolTip = "Read byte file"), Category = "FileHelper|File|Byte")
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "ReadByteFile", CompactNodeTitle = "ReadByte", Keywords = "File plugin read byte", ToolTip = "Read byte file, files written by WriteCompressedByteFile are decompressed"), Category = "FileHelper|File|Byte")
 	static bool ReadByte(FString Path, TArray<uint8>& Bytes);
 
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "WriteByteFile", CompactNodeTitle = "WriteByte", Keywords = "File plugin write byte", ToolTip = "Save byte to file"), Category = "FileHelper|File|Byte")
 	static bool SaveByte(FString Path, const TArray<uint8>& Bytes, FString& Error, bool Append = false, bool Force = false);
 
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "WriteCompressedByteFile", CompactNodeTitle = "WriteCompressedByte", Keywords = "File plugin write byte compress oodle zlib lz4", ToolTip = "Save compressed bytes to file, blocks are compressed in parallel and ReadByteFile decompresses them"), Category = "FileHelper|File|Byte")
+	static bool SaveCompressedByte(FString Path, const TArray<uint8>& Bytes, FString& Error, EFileHelperCompressionCodec Codec = EFileHelperCompressionCodec::Oodle, bool Force = false);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "HashFile", Keywords = "File plugin hash checksum xxhash blake3 changed", ToolTip = "Hashes the content of a file without loading it fully, large files are hashed in parallel"), Category = "FileHelper|File|Byte")
+	static bool HashFile(FString Path, FString& Hash, EFileHelperHashAlgorithm Algorithm = EFileHelperHashAlgorithm::XxHash3);
+
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "HashBytes", Keywords = "File plugin hash checksum xxhash blake3 bytes", ToolTip = "Hashes bytes, the hash matches HashFile for the same content"), Category = "FileHelper|File|Byte")
+	static FString HashBytes(const TArray<uint8>& Bytes, EFileHelperHashAlgorithm Algorithm = EFileHelperHashAlgorithm::XxHash3);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "FingerprintFile", Keywords = "File plugin hash fingerprint changed quick", ToolTip = "Cheap fingerprint from the size, modification time and first and last blocks of a file"), Category = "FileHelper|File|Byte")
+	static bool FingerprintFile(FString Path, FString& Fingerprint);
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "WriteCSVFile", CompactNodeTitle = "WriteCSV", Keywords = "File plugin write csv", ToolTip = "Save a csv file"), Category = "FileHelper|File|CSV")
-	static bool SaveCSV(FString Path, TArray<FString> Headers, TArray<FString> Data, int32& Total, bool Force = false);
+	static bool SaveCSV(const FString& Path, const TArray<FString>& Headers, const TArray<FString>& Data, int32& Total, bool Force = false, bool QuoteAll = true);
 
+	/**
+	 * @param Parallel - parse row ranges on worker threads, for large files
+	 * @param UseCache - read the rows from a binary sidecar (<file>.csvc) written on the first read and rebuilt when the file changes, takes precedence over Parallel
+	 */
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "ReadCSVFile", CompactNodeTitle = "ReadCSV", Keywords = "File plugin read csv", ToolTip = "Read a csv file"), Category = "FileHelper|File|CSV")
-	static bool ReadCSV(FString Path, TArray<FString>& Headers, TArray<FString>& Data, int32& Total, bool HeaderFirst = true);
+	static bool ReadCSV(const FString& Path, TArray<FString>& Headers, TArray<FString>& Data, int32& Total, bool HeaderFirst = true, bool Parallel = false, bool UseCache = false);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "RemoveCSVCache", Keywords = "File plugin csv cache sidecar", ToolTip = "Removes the binary sidecar written by ReadCSVFile with UseCache"), Category = "FileHelper|File|CSV")
+	static bool RemoveCSVCache(const FString& Path);
+
+	/** Only the Columns (all when empty) of the rows passing every filter are read, the first row must be the header */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "QueryCSVFile", Keywords = "File plugin read csv query select columns filter where", ToolTip = "Read selected columns of the rows of a csv file matching filters"), Category = "FileHelper|File|CSV")
+	static bool QueryCSV(const FString& Path, const TArray<FString>& Columns, const TArray<FFileHelperCSVFilter>& Filters, TArray<FString>& Headers, TArray<FString>& Data, int32& Total);
 
 	/* Network */
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "BytesToBase64", CompactNodeTitle = "ToBase64", Keywords = "File plugin bytes convert base64 encode", ToolTip = "Encodes a byte array to base64"), Category = "FileHelper|File|Byte")
-	static FString BytesToBase64(const TArray<uint8> Bytes);
+	static FString BytesToBase64(const TArray<uint8>& Bytes);
 
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "BytesFromBase64", CompactNodeTitle = "FromBase64", Keywords = "File plugin bytes convert base64 decode", ToolTip = "Decodes a byte array from base64"), Category = "FileHelper|File|Byte")
-	static bool BytesFromBase64(const FString Source, TArray<uint8>& Out);
+	static bool BytesFromBase64(const FString& Source, TArray<uint8>& Out);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "FileToBase64File", Keywords = "File plugin bytes convert base64 encode file stream", ToolTip = "Encodes a file to a base64 text file without loading it fully"), Category = "FileHelper|File|Byte")
+	static bool FileToBase64File(FString SourcePath, FString DestinationPath, FString& Error, bool Force = false);
 
 	/* CSV convert */
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "StringToCSV", CompactNodeTitle = "StrToCSV", Keywords = "File plugin string csv", ToolTip = "convert a string to csv"), Category = "FileHelper|CSV")
 	static bool StringToCSV(FString Content, TArray<FString>& Headers, TArray<FString>& Data, int32& Total, bool HeaderFirst = true);
 
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "QueryCSVString", Keywords = "File plugin string csv query select columns filter where", ToolTip = "Convert selected columns of the rows of a csv string matching filters"), Category = "FileHelper|CSV")
+	static bool StringToCSVQuery(const FString& Content, const TArray<FString>& Columns, const TArray<FFileHelperCSVFilter>& Filters, TArray<FString>& Headers, TArray<FString>& Data, int32& Total);
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CSVToString", CompactNodeTitle = "CSVToStr", Keywords = "File plugin csv string", ToolTip = "convert a csv to string"), Category = "FileHelper|CSV")
-	static bool CSVToString(FString& Result, TArray<FString> Headers, TArray<FString> Data, int32& Total);
+	static bool CSVToString(FString& Result, const TArray<FString>& Headers, const TArray<FString>& Data, int32& Total, bool QuoteAll = true);
 
 	/* File system */
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "IsFile", CompactNodeTitle = "IsFile", Keywords = "File plugin check file exist", ToolTip = "Check whether a file exists"), Category = "FileHelper|FileSystem")
@@ -231,11 +329,24 @@ public:
 	static void GetPathParts(FString Path, FString& PathPart, FString& BasePart, FString& ExtensionPart, FString& FileName);
 
 	/* Datatable */
+
+	/** Parallel writes ranges of rows on worker threads then joins them in row order, the output is the same as the serial export */
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DataTableToCSV", Keywords = "File plugin datatable csv convert export", ToolTip = "Converts a datatable to csv string"), Category = "FileHelper|Datatable")
-	static bool DatatableToCSV(UDataTable* Table, FString& Output);
+	static bool DatatableToCSV(UDataTable* Table, FString& Output, bool Parallel = false);
 
+	/**
+	 * Parallel writes ranges of rows on worker threads then joins them in row order, the output is the same as the serial export,
+	 * Condensed writes the json without indentation and line breaks
+	 */
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DataTableToJSON", Keywords = "File plugin datatable json convert export", ToolTip = "Converts a datatable to json string"), Category = "FileHelper|Datatable")
-	static bool DataTableToJSON(UDataTable* Table, FString& Output);
+	static bool DataTableToJSON(UDataTable* Table, FString& Output, bool Parallel = false, bool Condensed = false);
+
+	/** Same json as DataTableToJSON, encoded as UTF-8 while it is written to the file, an existing file is only replaced with Force */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DataTableToJSONFile", Keywords = "File plugin datatable json convert export file utf8 save", ToolTip = "Writes a datatable as UTF-8 json to a file"), Category = "FileHelper|Datatable")
+	static bool DataTableToJSONFile(UDataTable* Table, const FString& Path, FString& Error, bool Parallel = false, bool Condensed = false, bool Force = false);
+
+	/** Same json as DataTableToJSON written as UTF-8 bytes into OutUtf8 */
+	static bool DataTableToJSONUtf8(const UDataTable& Table, TArray<uint8>& OutUtf8, bool bInParallel = false, bool bInCondensed = false);
 
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CSVToDataTable", Keywords = "File plugin datatable csv convert import", ToolTip = "Converts a csv string to datatable"), Category = "FileHelper|Datatable")
 	static UDataTable* CSVToDataTable(FString CSV, UScriptStruct* Struct, bool& Success);
@@ -292,24 +403,35 @@ public:
 protected:
 	/* Utility */
 	static TArray<FString> SplitString(FString String, FString Separator, ESearchCase::Type SearchCase);
-	static bool StringArrayToCSV(TArray<FString> Lines, TArray<FString>& Headers, TArray<FString>& Data, int32& Total, FString Delimiter = ",", bool HeaderFirst = true);
+	static bool StringArrayToCSV(const TArray<FString>& Lines, TArray<FString>& Headers, TArray<FString>& Data, int32& Total, const FString& Delimiter = ",", bool HeaderFirst = true);
 	// config ini
 	static bool WriteConfigFile(FString Filename, FString Section, FString Key, FProperty* Type, void* Value, bool SingleLineArray);
 	static bool ReadConfigFile(FString Filename, FString Section, FString Key, FProperty* Type, void* Value, bool SingleLineArray);
 	static void FindOrCreateConfigFile(const FString& InFilePath, FConfigFile& OutConfigFile);
 	static bool SaveConfigFile(const FString& InFilePath);
 	// datatable csv
-	static bool WriteTableToCSV(const UDataTable& InDataTable, FString& Output);
+	static bool WriteTableToCSV(const UDataTable& InDataTable, FString& Output, bool bInParallel = false);
 	static bool WriteRowToCSV(const UScriptStruct* InRowStruct, const void* InRowData, FString& ExportedText);
+	static bool WriteRowToCSV(const FFileHelperExportPlan& InPlan, const void* InRowData, FString& ExportedText);
 	static bool WriteStructEntryToCSV(const void* InRowData, FProperty* InProperty, const void* InPropertyData, FString& ExportedText);
-	// datatable json
+	// datatable json, written with any char type and print policy (pretty or condensed TCHAR text, UTF-8)
 	static FString GetKeyFieldName(const UDataTable& InDataTable);
-	static bool WriteTableToJSON(const UDataTable& InDataTable, FString& OutExportText);
-	static bool WriteTableAsObjectToJSON(const UDataTable& InDataTable, TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter);
-	static bool WriteRowToJSON(const UScriptStruct* InRowStruct, const void* InRowData, TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter);
-	static bool WriteStructToJSON(const UScriptStruct* InStruct, const void* InStructData, TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter);
-	static bool WriteStructEntryToJSON(const void* InRowData, const FProperty* InProperty, const void* InPropertyData, TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter);
-	static bool WriteContainerEntryToJSON(const FProperty* InProperty, const void* InPropertyData, const FString* InIdentifier, TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter);
-	static void WriteJSONObjectStartWithOptionalIdentifier(TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter, const FString* InIdentifier);
-	static void WriteJSONValueWithOptionalIdentifier(TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter, const FString* InIdentifier, const TCHAR* InValue);
+	template <typename CharType, typename PrintPolicy, typename OutputType>
+	static bool WriteTableToJSON(const UDataTable& InDataTable, OutputType& Output, bool bInParallel = false);
+	template <typename CharType, typename PrintPolicy>
+	static bool WriteTableAsObjectToJSON(const UDataTable& InDataTable, TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter);
+	template <typename CharType, typename PrintPolicy>
+	static bool WriteRowToJSON(const UScriptStruct* InRowStruct, const void* InRowData, TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter);
+	template <typename CharType, typename PrintPolicy>
+	static bool WriteStructToJSON(const UScriptStruct* InStruct, const void* InStructData, TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter);
+	template <typename CharType, typename PrintPolicy>
+	static bool WriteStructToJSON(const FFileHelperExportPlan& InPlan, const void* InStructData, TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter);
+	template <typename CharType, typename PrintPolicy>
+	static bool WriteStructEntryToJSON(const void* InRowData, const FFileHelperExportField& InField, const void* InPropertyData, TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter);
+	template <typename CharType, typename PrintPolicy>
+	static bool WriteContainerEntryToJSON(const FProperty* InProperty, const void* InPropertyData, const FString* InIdentifier, TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter);
+	template <typename CharType, typename PrintPolicy>
+	static void WriteJSONObjectStartWithOptionalIdentifier(TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter, const FString* InIdentifier);
+	template <typename CharType, typename PrintPolicy>
+	static void WriteJSONValueWithOptionalIdentifier(TSharedRef<TJsonWriter<CharType, PrintPolicy>> JsonWriter, const FString* InIdentifier, const TCHAR* InValue);
 };
\ No newline at end of file
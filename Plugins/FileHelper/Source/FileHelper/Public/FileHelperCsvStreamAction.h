@@ -0,0 +1,82 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "HAL/Event.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include <atomic>
+#include "FileHelperCsvStreamAction.generated.h"
+
+/**
+ * Reads a csv file in bounded chunks on a worker thread and delivers its rows in batches,
+ * the file is never fully loaded and only a few batches wait for the game thread at once, the worker sleeps on an event until one is delivered,
+ * cancelling from a Rows handler stops the reading early
+ */
+UCLASS()
+class FILEHELPER_API UFileHelperReadCSVStreamAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOutputPin, const TArray<FString>&, Headers, const TArray<FString>&, Data, int32, Total);
+
+	/** Called for each batch of rows, Data holds the cells of the batch only and Total the number of rows read so far */
+	UPROPERTY(BlueprintAssignable)
+	FOutputPin Rows;
+
+	/** Called once every row was delivered, with the total number of rows */
+	UPROPERTY(BlueprintAssignable)
+	FOutputPin Completed;
+
+	/** Called when the file cannot be read or the reading is cancelled */
+	UPROPERTY(BlueprintAssignable)
+	FOutputPin Failed;
+
+	/** BatchSize is the number of rows per Rows call, the header row is not part of any batch when HeaderFirst is set */
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", Keywords = "File plugin read csv stream rows batch async", ToolTip = "Read a csv file in chunks on a worker thread and get its rows in batches"), Category = "FileHelper|File|CSV")
+	static UFileHelperReadCSVStreamAction* ReadCSVStreamAsync(const FString& Path, int32 BatchSize = 1000, bool HeaderFirst = true);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin read csv stream cancel stop", ToolTip = "Stops reading the csv file"), Category = "FileHelper|File|CSV")
+	void Cancel();
+
+private:
+	/** Reading state shared with the worker */
+	struct FStreamState
+	{
+		std::atomic<bool> bCancelled{ false };
+		/** Batches sent to the game thread and not delivered yet */
+		std::atomic<int32> PendingBatches{ 0 };
+		/** Triggered when a batch is delivered or the reading is cancelled */
+		FEventRef BatchDelivered{ EEventMode::AutoReset };
+
+		void Cancel()
+		{
+			bCancelled = true;
+			BatchDelivered->Trigger();
+		}
+	};
+
+	//~ Begin UBlueprintAsyncActionBase
+	virtual void Activate() override;
+	//~ End UBlueprintAsyncActionBase
+
+	void OnBatchRead(const TArray<FString>& InHeaders, const TArray<FString>& InData, int32 InTotal);
+
+	void OnTaskCompleted(bool bInSuccess, TArray<FString>&& InHeaders, int32 InTotal);
+
+	void Reset();
+
+	/** File path to read from */
+	UPROPERTY()
+	FString Path;
+
+	int32 BatchSize = 1000;
+
+	bool bHeaderFirst = true;
+
+	/** Shared with the worker so a cancel is seen between rows */
+	TSharedPtr<FStreamState, ESPMode::ThreadSafe> State;
+
+	/** Is this node active */
+	bool bActive = false;
+};
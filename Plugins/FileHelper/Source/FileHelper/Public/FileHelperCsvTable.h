@@ -0,0 +1,134 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "UObject/Object.h"
+#include "FileHelperCsvTable.generated.h"
+
+UENUM(BlueprintType)
+enum class EFileHelperCSVColumnType : uint8
+{
+	/** Every cell is a 64 bits integer */
+	Int,
+	/** Every cell is a number */
+	Double,
+	/** Every cell is true or false, case insensitive */
+	Bool,
+	/** Any other column, cells are pooled strings */
+	String
+};
+
+/**
+ * Columnar result of a csv read, each column gets the narrowest type its cells fit in and is stored as a contiguous typed array,
+ * empty cells are allowed in typed columns and read as 0 or false, a column with empty cells only is a string column,
+ * numbers with leading zeros (01234) are text so they are written back unchanged,
+ * column types are found in a first read of the rows and only cells of string columns are deduplicated in a string pool,
+ * the column count is the one of the first row, cells past it are dropped and missing cells are empty
+ */
+UCLASS(BlueprintType)
+class FILEHELPER_API UFileHelperCSVTable : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "ReadCSVTable", Keywords = "File plugin read csv table column typed", ToolTip = "Read a csv file into typed columns"), Category = "FileHelper|File|CSV")
+	static UFileHelperCSVTable* ReadCSVTable(const FString& Path, bool HeaderFirst = true);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "StringToCSVTable", Keywords = "File plugin string csv table column typed", ToolTip = "Convert a csv string into typed columns"), Category = "FileHelper|CSV")
+	static UFileHelperCSVTable* StringToCSVTable(const FString& Content, bool HeaderFirst = true);
+
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv table rows count"), Category = "FileHelper|CSV")
+	int32 GetRowCount() const
+	{
+		return RowCount;
+	}
+
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv table columns count"), Category = "FileHelper|CSV")
+	int32 GetColumnCount() const
+	{
+		return Columns.Num();
+	}
+
+	/** Header cells, or the column indexes as text without header row */
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv table headers columns names"), Category = "FileHelper|CSV")
+	TArray<FString> GetColumnNames() const;
+
+	/** Index of a column by name (case sensitive), -1 when not found */
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv table column find index"), Category = "FileHelper|CSV")
+	int32 FindColumn(const FString& Name) const;
+
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv table column type"), Category = "FileHelper|CSV")
+	EFileHelperCSVColumnType GetColumnType(int32 Column) const;
+
+	/** Cell as integer, doubles are truncated, 0 for other types or out of range */
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv table cell int integer"), Category = "FileHelper|CSV")
+	int64 GetInt(int32 Column, int32 Row) const;
+
+	/** Cell as double, 0 for strings, booleans or out of range */
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv table cell double float number"), Category = "FileHelper|CSV")
+	double GetDouble(int32 Column, int32 Row) const;
+
+	/** Cell as boolean, false for other types or out of range */
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv table cell bool boolean"), Category = "FileHelper|CSV")
+	bool GetBool(int32 Column, int32 Row) const;
+
+	/** Cell as text, typed cells are formatted back, empty when out of range */
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv table cell string text"), Category = "FileHelper|CSV")
+	FString GetString(int32 Column, int32 Row) const;
+
+	/** Copy of an integer column, empty for other types */
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv table column int integer array"), Category = "FileHelper|CSV")
+	TArray<int64> GetIntColumn(int32 Column) const;
+
+	/** Copy of a double column, integer columns are converted, empty for other types */
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv table column double float array"), Category = "FileHelper|CSV")
+	TArray<double> GetDoubleColumn(int32 Column) const;
+
+	/** Copy of a boolean column, empty for other types */
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv table column bool boolean array"), Category = "FileHelper|CSV")
+	TArray<bool> GetBoolColumn(int32 Column) const;
+
+	/** Copy of any column as text */
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv table column string text array"), Category = "FileHelper|CSV")
+	TArray<FString> GetStringColumn(int32 Column) const;
+
+	/** Values of a typed column without copy, empty when the column has another type */
+	TConstArrayView<int64> GetIntValues(int32 InColumn) const;
+	TConstArrayView<double> GetDoubleValues(int32 InColumn) const;
+	TConstArrayView<bool> GetBoolValues(int32 InColumn) const;
+
+	/** Indexes into GetStringPool of a string column, empty when the column has another type */
+	TConstArrayView<int32> GetStringIndexes(int32 InColumn) const;
+
+	TConstArrayView<FString> GetStringPool() const
+	{
+		return StringPool;
+	}
+
+private:
+	struct FColumn
+	{
+		FString Name;
+		EFileHelperCSVColumnType Type = EFileHelperCSVColumnType::String;
+		/** Only the array of the column type is filled */
+		TArray<int64> Ints;
+		TArray<double> Doubles;
+		TArray<bool> Bools;
+		TArray<int32> Strings;
+	};
+
+	/** Fills the table from the rows given by InReadRows to its visitor, InReadRows is called twice, to type the columns then to store the cells */
+	bool Build(TFunctionRef<bool(TFunctionRef<bool(TConstArrayView<FUtf8StringView>)>)> InReadRows, bool bInHeaderFirst);
+
+	const FColumn* GetColumn(int32 InColumn) const;
+
+	/** Column of a cell, nullptr when the column or the row is out of range */
+	const FColumn* GetCellColumn(int32 InColumn, int32 InRow) const;
+
+	TArray<FColumn> Columns;
+
+	/** Unique text of the string columns */
+	TArray<FString> StringPool;
+
+	int32 RowCount = 0;
+};
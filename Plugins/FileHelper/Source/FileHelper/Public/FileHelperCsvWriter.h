@@ -0,0 +1,96 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "HAL/CriticalSection.h"
+#include "UObject/Object.h"
+#include <type_traits>
+#include "FileHelperCsvWriter.generated.h"
+
+class UFileHelperFileAppender;
+
+/**
+ * Writes a csv file row by row for long sessions, the header is written once when the file is created,
+ * rows are formatted like SaveCSV and handed to a file appender that writes buffered blocks on a background task,
+ * queued blocks are capped so memory stays flat however many rows are written,
+ * when the disk falls behind, a flush blocks the calling thread, usually the game thread, until the queued blocks are written
+ */
+UCLASS(BlueprintType)
+class FILEHELPER_API UFileHelperCSVWriter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Headers also set the number of cells of every row, rows of any size are accepted without headers,
+	 * an existing file is appended to with Append, replaced with Force and left untouched otherwise,
+	 * at most 16 flushes of FlushSizeBytes are queued, a flush past that waits for the disk on the calling thread
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "OpenCSVWriter", Keywords = "File plugin csv write append stream rows log", ToolTip = "Opens a csv file to append rows with buffered background writes"), Category = "FileHelper|File|CSV")
+	static UFileHelperCSVWriter* OpenCSVWriter(const FString& Path, const TArray<FString>& Headers, FString& Error, bool Append = false, bool Force = false, bool QuoteAll = true, int32 FlushSizeBytes = 65536, float FlushIntervalSeconds = 1.f);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin csv write append row", ToolTip = "Appends a row of cells"), Category = "FileHelper|File|CSV")
+	bool AppendRow(const TArray<FString>& Cells);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin csv write append row number float", ToolTip = "Appends a row of numbers"), Category = "FileHelper|File|CSV")
+	bool AppendNumberRow(const TArray<double>& Values);
+
+	/** Appends a row of values of any type, numbers and booleans are formatted like AppendNumberRow and ReadCSVTable expect */
+	template <typename... ArgTypes>
+	bool AppendValues(const ArgTypes&... InValues)
+	{
+		return AppendRow({ ToCell(InValues)... });
+	}
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin csv write flush", ToolTip = "Sends the buffered rows to the background writer"), Category = "FileHelper|File|CSV")
+	void Flush();
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin csv write close", ToolTip = "Flushes the remaining rows and closes the file"), Category = "FileHelper|File|CSV")
+	void Close();
+
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv write open valid", ToolTip = "Whether rows can still be appended"), Category = "FileHelper|File|CSV")
+	bool IsOpen() const;
+
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv write error", ToolTip = "Whether a background write failed"), Category = "FileHelper|File|CSV")
+	bool HasWriteError() const;
+
+	/** Rows appended since the writer was opened, the header excluded */
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin csv write rows count"), Category = "FileHelper|File|CSV")
+	int32 GetRowCount() const;
+
+	/** Shortest text that reads back to the same double */
+	static FString FormatNumber(double InValue);
+
+private:
+	template <typename ValueType>
+	static FString ToCell(const ValueType& InValue)
+	{
+		if constexpr (std::is_same_v<ValueType, bool>)
+		{
+			return InValue ? TEXT("true") : TEXT("false");
+		}
+		else if constexpr (std::is_floating_point_v<ValueType>)
+		{
+			return FormatNumber(InValue);
+		}
+		else
+		{
+			return LexToString(InValue);
+		}
+	}
+
+	UPROPERTY()
+	TObjectPtr<UFileHelperFileAppender> Appender;
+
+	/** Number of cells per row, 0 when not enforced */
+	int32 ColumnCount = 0;
+
+	bool bQuoteAll = true;
+
+	int32 RowCount = 0;
+
+	/** Reused to format rows */
+	FString RowText;
+
+	mutable FCriticalSection RowLock;
+};
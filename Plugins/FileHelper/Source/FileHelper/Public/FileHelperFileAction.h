@@ -0,0 +1,258 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "FileHelperBPLibrary.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "FileHelperFileAction.generated.h"
+
+UCLASS()
+class FILEHELPER_API UFileHelperTextFileAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOutputPin, FString, Text, const TArray<FString>&, Lines, FString, Error);
+
+	UPROPERTY(BlueprintAssignable)
+	FOutputPin Completed;
+
+	UPROPERTY(BlueprintAssignable)
+	FOutputPin Failed;
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", Keywords = "File plugin read text async", ToolTip = "Read a standard text file on a worker thread"), Category = "FileHelper|File|Text")
+	static UFileHelperTextFileAction* ReadTextAsync(const FString& Path);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", Keywords = "File plugin write text async", ToolTip = "Save a standard text file on a worker thread"), Category = "FileHelper|File|Text")
+	static UFileHelperTextFileAction* SaveTextAsync(const FString& Path, const FString& Text, bool Append = false, bool Force = false);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", Keywords = "File plugin read text lines pattern async", ToolTip = "Read the lines of a standard text file on a worker thread"), Category = "FileHelper|File|Text")
+	static UFileHelperTextFileAction* ReadLineAsync(const FString& Path, const FString& Pattern, EFileHelperPatternMode Mode = EFileHelperPatternMode::Regex);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", Keywords = "File plugin read text lines range async", ToolTip = "Read range of lines of a standard text file on a worker thread"), Category = "FileHelper|File|Text")
+	static UFileHelperTextFileAction* ReadLineRangeAsync(const FString& Path, int32 StartIdx = 0, int32 EndIdx = -1);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", Keywords = "File plugin read text lines tail last async", ToolTip = "Read the last lines of a standard text file on a worker thread"), Category = "FileHelper|File|Text")
+	static UFileHelperTextFileAction* ReadLineTailAsync(const FString& Path, int32 Count = 10);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", Keywords = "File plugin text lines index async", ToolTip = "Builds the sidecar line index of a text file on a worker thread"), Category = "FileHelper|File|Text")
+	static UFileHelperTextFileAction* BuildLineIndexAsync(const FString& Path);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", Keywords = "File plugin write text lines async", ToolTip = "Save lines in a standard text file on a worker thread"), Category = "FileHelper|File|Text")
+	static UFileHelperTextFileAction* SaveLineAsync(const FString& Path, const TArray<FString>& Lines, bool Append = false, bool Force = false);
+
+private:
+	enum class EOperation : uint8
+	{
+		ReadText,
+		SaveText,
+		ReadLine,
+		ReadLineRange,
+		ReadLineTail,
+		BuildLineIndex,
+		SaveLine
+	};
+
+	//~ Begin UBlueprintAsyncActionBase
+	virtual void Activate() override;
+	//~ End UBlueprintAsyncActionBase
+
+	void OnTaskCompleted(bool bInSuccess, FString&& InText, TArray<FString>&& InLines, FString&& InError);
+
+	void Reset();
+
+	static UFileHelperTextFileAction* CreateNode(EOperation InOperation, const FString& InPath);
+
+	/** Operation to run on the worker thread */
+	EOperation Operation = EOperation::ReadText;
+
+	/** File path to read from or write to */
+	UPROPERTY()
+	FString Path;
+
+	/** Text to write or regex pattern to filter lines with */
+	UPROPERTY()
+	FString Text;
+
+	/** Lines to write */
+	UPROPERTY()
+	TArray<FString> Lines;
+
+	/** How the pattern is matched */
+	UPROPERTY()
+	EFileHelperPatternMode PatternMode = EFileHelperPatternMode::Regex;
+
+	UPROPERTY()
+	int32 StartIdx = 0;
+
+	/** Exclusive end line of a range read, number of lines for a tail read */
+	UPROPERTY()
+	int32 EndIdx = INDEX_NONE;
+
+	UPROPERTY()
+	bool bAppend = false;
+
+	UPROPERTY()
+	bool bForce = false;
+
+	/** Is this node active */
+	UPROPERTY()
+	bool bActive = false;
+};
+
+UCLASS()
+class FILEHELPER_API UFileHelperByteFileAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOutputPin, const TArray<uint8>&, Bytes, FString, Error);
+
+	UPROPERTY(BlueprintAssignable)
+	FOutputPin Completed;
+
+	UPROPERTY(BlueprintAssignable)
+	FOutputPin Failed;
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", Keywords = "File plugin read byte async", ToolTip = "Read byte file on a worker thread"), Category = "FileHelper|File|Byte")
+	static UFileHelperByteFileAction* ReadByteAsync(const FString& Path);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", Keywords = "File plugin write byte async", ToolTip = "Save byte to file on a worker thread"), Category = "FileHelper|File|Byte")
+	static UFileHelperByteFileAction* SaveByteAsync(const FString& Path, const TArray<uint8>& Bytes, bool Append = false, bool Force = false);
+
+private:
+	//~ Begin UBlueprintAsyncActionBase
+	virtual void Activate() override;
+	//~ End UBlueprintAsyncActionBase
+
+	void OnTaskCompleted(bool bInSuccess, TArray<uint8>&& InBytes, FString&& InError);
+
+	void Reset();
+
+	/** Read or write operation */
+	UPROPERTY()
+	bool bSave = false;
+
+	/** File path to read from or write to */
+	UPROPERTY()
+	FString Path;
+
+	/** Bytes to write */
+	UPROPERTY()
+	TArray<uint8> Bytes;
+
+	UPROPERTY()
+	bool bAppend = false;
+
+	UPROPERTY()
+	bool bForce = false;
+
+	/** Is this node active */
+	UPROPERTY()
+	bool bActive = false;
+};
+
+UCLASS()
+class FILEHELPER_API UFileHelperCSVFileAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOutputPin, const TArray<FString>&, Headers, const TArray<FString>&, Data, int32, Total);
+
+	UPROPERTY(BlueprintAssignable)
+	FOutputPin Completed;
+
+	UPROPERTY(BlueprintAssignable)
+	FOutputPin Failed;
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", Keywords = "File plugin read csv async", ToolTip = "Read a csv file on a worker thread"), Category = "FileHelper|File|CSV")
+	static UFileHelperCSVFileAction* ReadCSVAsync(const FString& Path, bool HeaderFirst = true, bool Parallel = false, bool UseCache = false);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", Keywords = "File plugin write csv async", ToolTip = "Save a csv file on a worker thread"), Category = "FileHelper|File|CSV")
+	static UFileHelperCSVFileAction* SaveCSVAsync(const FString& Path, const TArray<FString>& Headers, const TArray<FString>& Data, bool Force = false);
+
+private:
+	//~ Begin UBlueprintAsyncActionBase
+	virtual void Activate() override;
+	//~ End UBlueprintAsyncActionBase
+
+	void OnTaskCompleted(bool bInSuccess, TArray<FString>&& InHeaders, TArray<FString>&& InData, int32 InTotal);
+
+	void Reset();
+
+	/** Read or write operation */
+	UPROPERTY()
+	bool bSave = false;
+
+	/** File path to read from or write to */
+	UPROPERTY()
+	FString Path;
+
+	UPROPERTY()
+	TArray<FString> Headers;
+
+	UPROPERTY()
+	TArray<FString> Data;
+
+	UPROPERTY()
+	bool bHeaderFirst = true;
+
+	UPROPERTY()
+	bool bParallel = false;
+
+	UPROPERTY()
+	bool bUseCache = false;
+
+	UPROPERTY()
+	bool bForce = false;
+
+	/** Is this node active */
+	UPROPERTY()
+	bool bActive = false;
+};
+
+UCLASS()
+class FILEHELPER_API UFileHelperHashFileAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOutputPin, FString, Hash);
+
+	UPROPERTY(BlueprintAssignable)
+	FOutputPin Completed;
+
+	UPROPERTY(BlueprintAssignable)
+	FOutputPin Failed;
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", Keywords = "File plugin hash checksum xxhash blake3 async", ToolTip = "Hash the content of a file on worker threads"), Category = "FileHelper|File|Byte")
+	static UFileHelperHashFileAction* HashFileAsync(const FString& Path, EFileHelperHashAlgorithm Algorithm = EFileHelperHashAlgorithm::XxHash3);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", Keywords = "File plugin hash fingerprint changed async", ToolTip = "Compute the cheap fingerprint of a file on a worker thread"), Category = "FileHelper|File|Byte")
+	static UFileHelperHashFileAction* FingerprintFileAsync(const FString& Path);
+
+private:
+	//~ Begin UBlueprintAsyncActionBase
+	virtual void Activate() override;
+	//~ End UBlueprintAsyncActionBase
+
+	void OnTaskCompleted(bool bInSuccess, FString&& InHash);
+
+	void Reset();
+
+	/** Full hash or fingerprint */
+	UPROPERTY()
+	bool bFingerprint = false;
+
+	/** File path to hash */
+	UPROPERTY()
+	FString Path;
+
+	UPROPERTY()
+	EFileHelperHashAlgorithm Algorithm = EFileHelperHashAlgorithm::XxHash3;
+
+	/** Is this node active */
+	UPROPERTY()
+	bool bActive = false;
+};
@@ -0,0 +1,104 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+#include "Tasks/Task.h"
+#include "UObject/Object.h"
+#include <atomic>
+#include "FileHelperFileAppender.generated.h"
+
+class IFileHandle;
+
+/**
+ * Keeps a file open to append text at high frequency,
+ * text is encoded as UTF-8 and buffered in memory, buffers are written on a background task
+ * once they reach a size threshold, after a time interval, on Flush or on Close,
+ * writes are ordered and the game thread does not wait on disk unless a pending bytes limit is set,
+ * then a flush past the limit blocks the calling thread until every queued write is done
+ */
+UCLASS(BlueprintType)
+class FILEHELPER_API UFileHelperFileAppender : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "OpenAppender", Keywords = "File plugin append write text buffered log", ToolTip = "Opens a file to append text with buffered background writes"), Category = "FileHelper|File|Text")
+	static UFileHelperFileAppender* OpenAppender(const FString& Path, FString& Error, bool Truncate = false, int32 FlushSizeBytes = 65536, float FlushIntervalSeconds = 1.f);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin append write text", ToolTip = "Appends text to the buffer"), Category = "FileHelper|File|Text")
+	bool Write(const FString& Text);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin append write text line", ToolTip = "Appends text followed by a line terminator to the buffer"), Category = "FileHelper|File|Text")
+	bool WriteLine(const FString& Text);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin append flush", ToolTip = "Sends the buffered text to the background writer"), Category = "FileHelper|File|Text")
+	void Flush();
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin append close", ToolTip = "Flushes the remaining text and closes the file"), Category = "FileHelper|File|Text")
+	void Close();
+
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin append open valid", ToolTip = "Whether the appender can still be written to"), Category = "FileHelper|File|Text")
+	bool IsOpen() const;
+
+	/** Whether a background write failed since the appender was opened */
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin append error", ToolTip = "Whether a background write failed"), Category = "FileHelper|File|Text")
+	bool HasWriteError() const;
+
+	/** Blocks until every flushed buffer has been written to disk */
+	void WaitForWrites() const;
+
+	/** While more than this many bytes are queued a flush blocks the calling thread until every queued write is done, no limit when not positive */
+	void SetMaxPendingBytes(int64 InMaxPendingBytes);
+
+	//~ Begin UObject
+	virtual void BeginDestroy() override;
+	//~ End UObject
+
+private:
+	/** File state shared with the background writes */
+	struct FWriterState
+	{
+		TUniquePtr<IFileHandle> Handle;
+		std::atomic<bool> bWriteError{ false };
+		/** Bytes flushed and not written yet */
+		std::atomic<int64> PendingBytes{ 0 };
+
+		~FWriterState();
+	};
+
+	bool Append(const TCHAR* InText, int32 InLen);
+
+	/** Queues a write of the current buffer after the previous ones, lock must be held */
+	void FlushLocked(bool bInClose);
+
+	bool Tick(float InDeltaTime);
+
+	/** Path of the file */
+	FString Path;
+
+	/** Pending UTF-8 bytes */
+	TArray<uint8> Buffer;
+
+	/** Buffer size that triggers a flush */
+	int32 FlushSize = 65536;
+
+	/** Seconds after which a non empty buffer is flushed, disabled when not positive */
+	float FlushInterval = 1.f;
+
+	/** Queued bytes above which flushes wait, disabled when not positive */
+	int64 MaxPendingBytes = 0;
+
+	/** Time of the last flush */
+	double LastFlushTime = 0.0;
+
+	/** Last background write, next writes depend on it */
+	UE::Tasks::FTask LastWrite;
+
+	TSharedPtr<FWriterState, ESPMode::ThreadSafe> State;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	mutable FCriticalSection BufferLock;
+};
@@ -0,0 +1,58 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "UObject/Object.h"
+#include "FileHelperFileFollower.generated.h"
+
+class FRunnableThread;
+class FFileHelperFollowRunnable;
+
+/**
+ * Follows a growing text file like tail -f, the last read offset is remembered so only appended bytes are read,
+ * complete lines are delivered on the game thread, a trailing line without line break is kept until it is completed,
+ * changes are detected with inotify on Linux and by polling the file size elsewhere,
+ * the file is read from the start again when it is truncated, UTF-16 files are not supported
+ */
+UCLASS(BlueprintType)
+class FILEHELPER_API UFileHelperFileFollower : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual ~UFileHelperFileFollower() override;
+
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLinesAppended, const TArray<FString>&, Lines);
+
+	/** Called on the game thread with the lines appended since the last call, empty lines are skipped */
+	UPROPERTY(BlueprintAssignable)
+	FOnLinesAppended OnLinesAppended;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "FollowFile", Keywords = "File plugin follow tail watch log line", ToolTip = "Follows a text file and notifies appended lines"), Category = "FileHelper|File|Text")
+	static UFileHelperFileFollower* FollowFile(const FString& Path, bool FromEnd = true, float PollIntervalSeconds = 0.25f);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin follow tail stop", ToolTip = "Stops following the file"), Category = "FileHelper|File|Text")
+	void Stop();
+
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin follow tail active", ToolTip = "Whether the file is still followed"), Category = "FileHelper|File|Text")
+	bool IsFollowing() const;
+
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin follow tail path", ToolTip = "Path of the followed file"), Category = "FileHelper|File|Text")
+	FString GetPath() const;
+
+	//~ Begin UObject
+	virtual void BeginDestroy() override;
+	//~ End UObject
+
+private:
+	friend class FFileHelperFollowRunnable;
+
+	void OnLinesRead(TArray<FString>&& InLines);
+
+	/** Path of the followed file */
+	FString Path;
+
+	TUniquePtr<FFileHelperFollowRunnable> Runnable;
+
+	TUniquePtr<FRunnableThread> Thread;
+};
@@ -0,0 +1,78 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/Object.h"
+#include "FileHelperFileHandle.generated.h"
+
+UENUM(BlueprintType)
+enum class EFileHelperFileAccess : uint8
+{
+	/** Read only, the file must exist */
+	Read,
+	/** Read and write, the file is created when not found and never truncated on open */
+	ReadWrite
+};
+
+/**
+ * Open file for random access, reads and writes only touch the requested bytes,
+ * calls are serialized so a handle can be shared between threads,
+ * the file is closed on Close or when the object is garbage collected
+ */
+UCLASS(BlueprintType)
+class FILEHELPER_API UFileHelperFileHandle : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "OpenFileHandle", Keywords = "File plugin open handle random access byte", ToolTip = "Opens a file for random access reads and writes"), Category = "FileHelper|File|Byte")
+	static UFileHelperFileHandle* OpenFileHandle(const FString& Path, EFileHelperFileAccess Access, FString& Error);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin handle read byte offset pread", ToolTip = "Reads bytes at an offset, less bytes are returned when the end of file is reached"), Category = "FileHelper|File|Byte")
+	bool ReadAt(int64 Offset, int64 Length, TArray<uint8>& Bytes);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin handle write byte offset pwrite", ToolTip = "Writes bytes at an offset, the file grows when writing past its end"), Category = "FileHelper|File|Byte")
+	bool WriteAt(int64 Offset, const TArray<uint8>& Bytes);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin handle truncate resize", ToolTip = "Truncates or extends the file to a size"), Category = "FileHelper|File|Byte")
+	bool Truncate(int64 Size);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin handle flush", ToolTip = "Flushes written bytes to disk"), Category = "FileHelper|File|Byte")
+	bool Flush();
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin handle close", ToolTip = "Closes the file"), Category = "FileHelper|File|Byte")
+	void Close();
+
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin handle open valid", ToolTip = "Whether the file is still open"), Category = "FileHelper|File|Byte")
+	bool IsOpen() const;
+
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin handle size", ToolTip = "Current size of the file in bytes"), Category = "FileHelper|File|Byte")
+	int64 GetSize() const;
+
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin handle path", ToolTip = "Path of the file"), Category = "FileHelper|File|Byte")
+	FString GetPath() const;
+
+	/** Reads up to OutBytes.Num() bytes at an offset into a caller buffer, returns the number of bytes read or -1 on error */
+	int64 ReadInto(int64 InOffset, TArrayView64<uint8> OutBytes);
+
+	/** Writes bytes at an offset */
+	bool WriteFrom(int64 InOffset, TConstArrayView64<uint8> InBytes);
+
+	//~ Begin UObject
+	virtual void BeginDestroy() override;
+	//~ End UObject
+
+private:
+	/** Path of the file */
+	FString Path;
+
+	/** Access requested on open */
+	EFileHelperFileAccess Access = EFileHelperFileAccess::Read;
+
+	/** Platform handle, seek and read/write must happen under the lock */
+	TUniquePtr<IFileHandle> Handle;
+
+	mutable FCriticalSection HandleLock;
+};
@@ -0,0 +1,55 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "Async/MappedFileHandle.h"
+#include "UObject/Object.h"
+#include "FileHelperMappedFile.generated.h"
+
+/**
+ * Read-only memory mapped view of a file,
+ * pages are loaded lazily by the OS when accessed and nothing is copied until ReadBytes is called,
+ * the file is unmapped when Close is called or when the object is garbage collected
+ */
+UCLASS(BlueprintType)
+class FILEHELPER_API UFileHelperMappedFile : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "OpenMappedFile", Keywords = "File plugin read byte map mapped memory", ToolTip = "Maps a file in memory for read only access without loading it"), Category = "FileHelper|File|Byte")
+	static UFileHelperMappedFile* OpenMappedFile(const FString& Path);
+
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin mapped valid open", ToolTip = "Whether the file is still mapped"), Category = "FileHelper|File|Byte")
+	bool IsOpen() const;
+
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin mapped size", ToolTip = "Size of the mapped file in bytes"), Category = "FileHelper|File|Byte")
+	int64 GetSize() const;
+
+	UFUNCTION(BlueprintPure, meta = (Keywords = "File plugin mapped path", ToolTip = "Path of the mapped file"), Category = "FileHelper|File|Byte")
+	FString GetPath() const;
+
+	/** Copies a range of the mapped file, only the pages covering this range are touched, fails once the file is closed */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin mapped read byte range", ToolTip = "Copies a range of bytes from the mapped file"), Category = "FileHelper|File|Byte")
+	bool ReadBytes(int64 Offset, int64 Length, TArray<uint8>& Bytes) const;
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin mapped close unmap", ToolTip = "Unmaps the file, the mapped file cannot be read afterwards"), Category = "FileHelper|File|Byte")
+	void Close();
+
+	/** Zero-copy view of the whole file, only valid until Close is called */
+	TConstArrayView64<uint8> GetView() const;
+
+	//~ Begin UObject
+	virtual void BeginDestroy() override;
+	//~ End UObject
+
+private:
+	/** Path of the mapped file */
+	FString Path;
+
+	/** Handle to the file, must outlive the region */
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+
+	/** Region covering the whole file */
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+};
@@ -0,0 +1,61 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FFileHelperCSVFilter;
+
+/**
+ * C++ entry points of the text and csv functions of UFileHelperBPLibrary,
+ * inputs are taken as views or rvalues and outputs are written into caller buffers so nothing is copied on the way,
+ * the Blueprint functions forward to these
+ */
+class FILEHELPER_API FFileHelperNative
+{
+public:
+	/* Text */
+	static bool ReadText(const FString& InPath, FString& OutText);
+	static bool SaveText(const FString& InPath, FStringView InText, FString& OutError, bool bInAppend = false, bool bInForce = false);
+
+	/* CSV file */
+
+	/** With bInUseCache the rows come from a binary sidecar of the parsed file (<file>.csvc), written on the first read and rebuilt when the file changes */
+	static bool ReadCSV(const FString& InPath, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal, bool bInHeaderFirst = true, bool bInUseCache = false);
+
+	/**
+	 * Same result as ReadCSV, the file is loaded then cut at row boundaries into a few ranges per worker thread,
+	 * ranges are tokenized and converted on the task graph and their rows are appended in file order
+	 */
+	static bool ReadCSVParallel(const FString& InPath, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal, bool bInHeaderFirst = true);
+
+	/**
+	 * Reads the InColumns (all when empty) of the rows passing every filter, the first row is the header,
+	 * filters are tested on the UTF-8 cells while the file is streamed so skipped cells and rows are never converted,
+	 * fails when a column is not in the header, OutTotal counts the header and the matching rows
+	 */
+	static bool QueryCSV(const FString& InPath, TConstArrayView<FString> InColumns, TConstArrayView<FFileHelperCSVFilter> InFilters, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal);
+
+	/** Writes the csv text as UTF-8 straight to the file in bounded chunks, cells are quoted like in CSVToString */
+	static bool SaveCSV(const FString& InPath, TConstArrayView<FString> InHeaders, TConstArrayView<FString> InData, int32& OutTotal, bool bInForce = false, bool bInQuoteAll = true);
+
+	/* CSV convert */
+
+	/** Parses csv text with the same rules as FCsvParser, the text is tokenized as UTF-8 like ReadCSV */
+	static bool StringToCSV(FStringView InContent, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal, bool bInHeaderFirst = true);
+
+	/** Same as QueryCSV on csv text */
+	static bool StringToCSVQuery(FStringView InContent, TConstArrayView<FString> InColumns, TConstArrayView<FFileHelperCSVFilter> InFilters, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal);
+
+	/**
+	 * Appends the csv text of the headers and data to OutResult in one pass over a reserved buffer,
+	 * every cell is quoted unless bInQuoteAll is false, then only cells with delimiters, quotes or new lines are
+	 */
+	static bool CSVToString(FString& OutResult, TConstArrayView<FString> InHeaders, TConstArrayView<FString> InData, int32& OutTotal, bool bInQuoteAll = true);
+
+	/** Appends one csv row and its line terminator to OutResult, cells are quoted like in CSVToString */
+	static void AppendCSVRow(FString& OutResult, TConstArrayView<FString> InCells, bool bInQuoteAll = true);
+
+	/** Splits lines of quoted cells separated by a delimiter, lines without a quoted delimiter are skipped */
+	static bool StringArrayToCSV(TConstArrayView<FString> InLines, TArray<FString>& OutHeaders, TArray<FString>& OutData, int32& OutTotal, FStringView InDelimiter = TEXT(","), bool bInHeaderFirst = true);
+};
@@ -0,0 +1,94 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "FileHelperBPLibrary.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include <atomic>
+#include "FileHelperSearchAction.generated.h"
+
+USTRUCT(BlueprintType)
+struct FFileHelperSearchMatch
+{
+	GENERATED_BODY()
+
+	/** Path of the file relative to the searched directory */
+	UPROPERTY(BlueprintReadOnly, Category = "FileHelper|Search")
+	FString Path;
+
+	/** Index of the line in the file, empty lines are not counted like in ReadLineRange */
+	UPROPERTY(BlueprintReadOnly, Category = "FileHelper|Search")
+	int32 LineIndex = 0;
+
+	/** Matching line */
+	UPROPERTY(BlueprintReadOnly, Category = "FileHelper|Search")
+	FString Line;
+};
+
+/**
+ * Searches the lines of every file in a directory tree on worker threads,
+ * files are matched in parallel with the same regex or substring matching as ReadLine,
+ * matches of each file are sent as soon as the file is done, the search stops once the result cap is reached or when cancelled
+ */
+UCLASS()
+class FILEHELPER_API UFileHelperSearchFilesAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOutputPin, const TArray<FFileHelperSearchMatch>&, Matches);
+
+	/** Called for each file with matches */
+	UPROPERTY(BlueprintAssignable)
+	FOutputPin Found;
+
+	/** Called with every match once the search is over */
+	UPROPERTY(BlueprintAssignable)
+	FOutputPin Completed;
+
+	/** Called when the directory is not found or the search is cancelled, with the matches found so far */
+	UPROPERTY(BlueprintAssignable)
+	FOutputPin Failed;
+
+	/**
+	 * FilePattern is a regex applied to the file paths relative to the directory like in ListDirectory, empty for every file,
+	 * MaxResults caps the number of matches, no cap when not positive
+	 */
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", Keywords = "File plugin search grep find lines pattern directory async", ToolTip = "Search the lines of files in a directory on worker threads"), Category = "FileHelper|FileSystem")
+	static UFileHelperSearchFilesAction* SearchFilesAsync(const FString& Directory, const FString& Pattern, EFileHelperPatternMode Mode = EFileHelperPatternMode::Regex, const FString& FilePattern = TEXT(""), bool Recursive = true, int32 MaxResults = 1000);
+
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "File plugin search grep cancel stop", ToolTip = "Stops the search"), Category = "FileHelper|FileSystem")
+	void Cancel();
+
+private:
+	//~ Begin UBlueprintAsyncActionBase
+	virtual void Activate() override;
+	//~ End UBlueprintAsyncActionBase
+
+	void OnTaskCompleted(bool bInSuccess, TArray<FFileHelperSearchMatch>&& InMatches);
+
+	void Reset();
+
+	/** Directory to search in */
+	UPROPERTY()
+	FString Directory;
+
+	/** Pattern to match lines with */
+	UPROPERTY()
+	FString Pattern;
+
+	/** Regex to filter files with */
+	UPROPERTY()
+	FString FilePattern;
+
+	EFileHelperPatternMode PatternMode = EFileHelperPatternMode::Regex;
+
+	bool bRecursive = true;
+
+	int32 MaxResults = 1000;
+
+	/** Shared with the workers so a cancel is seen while files are matched */
+	TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> CancelFlag;
+
+	bool bActive = false;
+};
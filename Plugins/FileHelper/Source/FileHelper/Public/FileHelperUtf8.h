@@ -0,0 +1,45 @@
+// Copyright 2025 RLoris
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Utf8String.h"
+
+/**
+ * UTF-8 read path for C++ callers, text is kept as UTF-8 bytes instead of being widened to TCHAR,
+ * UTF-8 byte order marks are skipped and UTF-16 files are converted to UTF-8 so every encoding is accepted
+ */
+class FILEHELPER_API FFileHelperUtf8
+{
+public:
+	/** Loads a text file as UTF-8 bytes, without byte order mark and without null terminator */
+	static bool LoadFile(const FString& InPath, TArray<uint8>& OutText);
+
+	/** Loads a text file as an UTF-8 string */
+	static bool ReadText(const FString& InPath, FUtf8String& OutText);
+
+	/**
+	 * Streams the lines of a text file, lines are split and skipped like FFileHelper::LoadFileToStringArray,
+	 * a line view is only valid during the visitor call, stops as soon as the visitor returns false
+	 */
+	static bool VisitLines(const FString& InPath, TFunctionRef<bool(FUtf8StringView)> InVisitor);
+
+	/**
+	 * Parses csv text with the same rules as FCsvParser, quoted cells are unescaped in place so the text is modified,
+	 * cell views point into the text, stops as soon as the visitor returns false
+	 */
+	static void ParseCSV(TArrayView<uint8> InOutText, TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor);
+
+	/** Parses TCHAR csv text, it is converted once to an UTF-8 buffer that the cell views point into */
+	static void ParseCSV(FStringView InText, TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor);
+
+	/** Loads and parses a csv file, cell views are only valid during the visitor call */
+	static bool ReadCSV(const FString& InPath, TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor);
+
+	/**
+	 * Parses a csv file in bounded chunks instead of loading it whole, rows are the same as with ReadCSV,
+	 * a row spanning chunks (quoted new lines or long rows) is carried to the next chunk,
+	 * cell views are only valid during the visitor call, stops reading as soon as the visitor returns false
+	 */
+	static bool StreamCSV(const FString& InPath, TFunctionRef<bool(TConstArrayView<FUtf8StringView>)> InRowVisitor, int32 InChunkSize = 256 * 1024);
+};